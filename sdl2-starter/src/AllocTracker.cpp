@@ -0,0 +1,265 @@
+#include "AllocTracker.h"
+#include <SDL2/SDL.h>
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <mutex>
+#include <new>
+
+namespace {
+    // Plain arrays and PODs only: these are touched from inside operator new,
+    // possibly before main, so they can't need constructing or allocate
+    struct ThreadCounters {
+        uint64_t allocs[AllocTracker::MAX_TAGS];
+        uint64_t bytes[AllocTracker::MAX_TAGS];
+        uint64_t frees;
+    };
+
+    thread_local ThreadCounters counters;
+    thread_local int currentTag = 0;
+
+    const char* tagNames[AllocTracker::MAX_TAGS] = {"untagged"};
+    int tagCount = 1;
+    std::mutex tagMutex;
+
+    // Main thread's counts at the end of the previous frame
+    uint64_t lastAllocs[AllocTracker::MAX_TAGS];
+    uint64_t lastBytes[AllocTracker::MAX_TAGS];
+    uint64_t lastFrees = 0;
+    uint64_t frees = 0;
+    uint64_t maxFrameFrees = 0;
+    AllocTracker::TagStats stats[AllocTracker::MAX_TAGS];
+    int frames = 0;
+    uint64_t lastFrameAllocs = 0;
+    uint64_t lastFrameBytes = 0;
+    bool steadyState = false;
+
+    // SDL's allocator from before hookSDL()
+    SDL_malloc_func sdlMalloc = nullptr;
+    SDL_calloc_func sdlCalloc = nullptr;
+    SDL_realloc_func sdlRealloc = nullptr;
+    SDL_free_func sdlFree = nullptr;
+
+    void* countedMalloc(size_t size) {
+        AllocTracker::recordAlloc(size);
+        return sdlMalloc(size);
+    }
+
+    void* countedCalloc(size_t count, size_t size) {
+        AllocTracker::recordAlloc(count * size);
+        return sdlCalloc(count, size);
+    }
+
+    void* countedRealloc(void* memory, size_t size) {
+        AllocTracker::recordAlloc(size);
+        return sdlRealloc(memory, size);
+    }
+
+    void countedFree(void* memory) {
+        if (memory) AllocTracker::recordFree();
+        sdlFree(memory);
+    }
+}
+
+int AllocTracker::registerTag(const char* name) {
+    std::lock_guard<std::mutex> lock(tagMutex);
+    for (int i = 0; i < tagCount; i++) {
+        if (std::strcmp(tagNames[i], name) == 0) return i;
+    }
+    if (tagCount == MAX_TAGS) return 0;  // Out of tags; count it as untagged
+    tagNames[tagCount] = name;
+    return tagCount++;
+}
+
+const char* AllocTracker::getTagName(int tag) {
+    return tag >= 0 && tag < tagCount ? tagNames[tag] : "?";
+}
+
+int AllocTracker::getTagCount() {
+    return tagCount;
+}
+
+void AllocTracker::recordAlloc(size_t bytes) {
+    counters.allocs[currentTag]++;
+    counters.bytes[currentTag] += bytes;
+}
+
+void AllocTracker::recordFree() {
+    counters.frees++;
+}
+
+void AllocTracker::hookSDL() {
+#if ALLOC_TRACKING
+    if (sdlMalloc) return;
+    SDL_GetMemoryFunctions(&sdlMalloc, &sdlCalloc, &sdlRealloc, &sdlFree);
+    SDL_SetMemoryFunctions(countedMalloc, countedCalloc, countedRealloc, countedFree);
+#endif
+}
+
+void AllocTracker::endFrame() {
+    frames++;
+    lastFrameAllocs = 0;
+    lastFrameBytes = 0;
+
+    uint64_t frameFrees = counters.frees - lastFrees;
+    lastFrees = counters.frees;
+    frees += frameFrees;
+    maxFrameFrees = std::max(maxFrameFrees, frameFrees);
+
+    for (int tag = 0; tag < tagCount; tag++) {
+        uint64_t frameAllocs = counters.allocs[tag] - lastAllocs[tag];
+        uint64_t frameBytes = counters.bytes[tag] - lastBytes[tag];
+        lastAllocs[tag] = counters.allocs[tag];
+        lastBytes[tag] = counters.bytes[tag];
+        if (frameAllocs == 0) continue;
+
+        lastFrameAllocs += frameAllocs;
+        lastFrameBytes += frameBytes;
+
+        TagStats& tagStats = stats[tag];
+        tagStats.allocs += frameAllocs;
+        tagStats.bytes += frameBytes;
+        tagStats.maxFrameAllocs = std::max(tagStats.maxFrameAllocs, frameAllocs);
+        tagStats.maxFrameBytes = std::max(tagStats.maxFrameBytes, frameBytes);
+        tagStats.framesAllocating++;
+
+        if (steadyState && tag != 0) {
+            fprintf(stderr, "Steady-state frame %d allocated %llu times (%llu bytes) in %s\n", frames,
+                    static_cast<unsigned long long>(frameAllocs),
+                    static_cast<unsigned long long>(frameBytes), tagNames[tag]);
+            assert(!"allocation in a steady-state frame");
+        }
+    }
+}
+
+void AllocTracker::setSteadyState(bool steady) {
+    steadyState = steady;
+}
+
+bool AllocTracker::isSteadyState() {
+    return steadyState;
+}
+
+void AllocTracker::reset() {
+    for (int tag = 0; tag < MAX_TAGS; tag++) {
+        lastAllocs[tag] = counters.allocs[tag];
+        lastBytes[tag] = counters.bytes[tag];
+        stats[tag] = TagStats();
+    }
+    lastFrees = counters.frees;
+    frees = 0;
+    maxFrameFrees = 0;
+    frames = 0;
+}
+
+int AllocTracker::getFrameCount() {
+    return frames;
+}
+
+const AllocTracker::TagStats& AllocTracker::getStats(int tag) {
+    return stats[tag];
+}
+
+uint64_t AllocTracker::getLastFrameAllocs() {
+    return lastFrameAllocs;
+}
+
+uint64_t AllocTracker::getLastFrameBytes() {
+    return lastFrameBytes;
+}
+
+uint64_t AllocTracker::getFrees() {
+    return frees;
+}
+
+uint64_t AllocTracker::getMaxFrameFrees() {
+    return maxFrameFrees;
+}
+
+void AllocTracker::printReport(std::ostream& out) {
+    if (!isEnabled()) {
+        out << "Allocation tracking is compiled out (ALLOC_TRACKING=0)" << std::endl;
+        return;
+    }
+
+    int nameWidth = 12;
+    for (int tag = 0; tag < tagCount; tag++) {
+        nameWidth = std::max(nameWidth, static_cast<int>(std::strlen(tagNames[tag])) + 1);
+    }
+
+    double perFrame = frames > 0 ? 1.0 / frames : 0.0;
+    out << "==== heap allocations (" << frames << " frames) ====" << std::endl;
+    out << std::fixed << std::setprecision(1);
+    out << std::left << std::setw(nameWidth) << "tag" << std::right << std::setw(12) << "allocs/frame"
+        << std::setw(12) << "bytes/frame" << std::setw(12) << "max allocs" << std::setw(12) << "max bytes"
+        << std::setw(10) << "frames" << std::endl;
+    for (int tag = 0; tag < tagCount; tag++) {
+        const TagStats& tagStats = stats[tag];
+        if (tagStats.allocs == 0) continue;
+        out << std::left << std::setw(nameWidth) << tagNames[tag] << std::right
+            << std::setw(12) << tagStats.allocs * perFrame << std::setw(12) << tagStats.bytes * perFrame
+            << std::setw(12) << tagStats.maxFrameAllocs << std::setw(12) << tagStats.maxFrameBytes
+            << std::setw(10) << tagStats.framesAllocating << std::endl;
+    }
+    out << std::left << std::setw(nameWidth) << "frees (all)" << std::right
+        << std::setw(12) << frees * perFrame << std::setw(12) << "" << std::setw(12) << maxFrameFrees
+        << std::endl;
+}
+
+AllocScope::AllocScope(int tag) : previous(currentTag) {
+    currentTag = tag;
+}
+
+AllocScope::~AllocScope() {
+    currentTag = previous;
+}
+
+#if ALLOC_TRACKING
+// Global allocation hooks: malloc underneath, with the standard new_handler loop
+static void* trackedNew(std::size_t size) {
+    if (size == 0) size = 1;
+    void* memory;
+    while ((memory = std::malloc(size)) == nullptr) {
+        std::new_handler handler = std::get_new_handler();
+        if (!handler) throw std::bad_alloc();
+        handler();
+    }
+    AllocTracker::recordAlloc(size);
+    return memory;
+}
+
+static void trackedDelete(void* memory) noexcept {
+    if (!memory) return;
+    AllocTracker::recordFree();
+    std::free(memory);
+}
+
+void* operator new(std::size_t size) { return trackedNew(size); }
+void* operator new[](std::size_t size) { return trackedNew(size); }
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return trackedNew(size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return trackedNew(size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void operator delete(void* memory) noexcept { trackedDelete(memory); }
+void operator delete[](void* memory) noexcept { trackedDelete(memory); }
+void operator delete(void* memory, std::size_t) noexcept { trackedDelete(memory); }
+void operator delete[](void* memory, std::size_t) noexcept { trackedDelete(memory); }
+void operator delete(void* memory, const std::nothrow_t&) noexcept { trackedDelete(memory); }
+void operator delete[](void* memory, const std::nothrow_t&) noexcept { trackedDelete(memory); }
+#endif
@@ -0,0 +1,101 @@
+#ifndef ALLOC_TRACKER_H
+#define ALLOC_TRACKER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+// Heap allocation tracking. On by default in debug builds, off under NDEBUG;
+// build with -DALLOC_TRACKING=0/1 to choose. When on, AllocTracker.cpp replaces
+// the global operator new/delete and hooks SDL's allocator, and every
+// allocation is counted (per thread, no locking) against the innermost
+// ALLOC_SCOPE tag on that thread.
+#ifndef ALLOC_TRACKING
+#ifdef NDEBUG
+#define ALLOC_TRACKING 0
+#else
+#define ALLOC_TRACKING 1
+#endif
+#endif
+
+#define ALLOC_CONCAT_INNER(a, b) a##b
+#define ALLOC_CONCAT(a, b) ALLOC_CONCAT_INNER(a, b)
+
+#if ALLOC_TRACKING
+// Charge allocations made in the rest of the enclosing block to name
+#define ALLOC_SCOPE(name) \
+    static const int ALLOC_CONCAT(allocTag_, __LINE__) = AllocTracker::registerTag(name); \
+    AllocScope ALLOC_CONCAT(allocScope_, __LINE__)(ALLOC_CONCAT(allocTag_, __LINE__))
+#else
+#define ALLOC_SCOPE(name) do {} while (0)
+#endif
+
+// Per-tag allocation counts, rolled up once per frame. Counters are thread
+// local; the frame statistics are the calling (main) thread's, so decode and
+// logger threads never show up in a frame. Nothing here allocates.
+class AllocTracker {
+public:
+    static const int MAX_TAGS = 64;  // tag 0 is everything outside an ALLOC_SCOPE
+
+    struct TagStats {
+        uint64_t allocs;          // over every frame since the last reset()
+        uint64_t bytes;
+        uint64_t maxFrameAllocs;
+        uint64_t maxFrameBytes;
+        int framesAllocating;     // frames where this tag allocated at all
+    };
+
+    static bool isEnabled() { return ALLOC_TRACKING != 0; }
+
+    // Tag index for name, shared by every scope using the same name
+    static int registerTag(const char* name);
+    static const char* getTagName(int tag);
+    static int getTagCount();
+
+    // Called by the allocation hooks
+    static void recordAlloc(size_t bytes);
+    static void recordFree();
+
+    // Route SDL's own mallocs through the counters too; call before SDL_Init
+    static void hookSDL();
+
+    // Close a frame: fold this thread's counts since the last call into the
+    // per-tag stats. In a steady-state frame any tagged allocation is a bug:
+    // it's reported on stderr and asserts in debug builds.
+    static void endFrame();
+
+    static void setSteadyState(bool steady);
+    static bool isSteadyState();
+
+    // Forget the stats so far, e.g. after a warmup
+    static void reset();
+
+    static int getFrameCount();
+    static const TagStats& getStats(int tag);
+
+    // Every tag together, for the frame the last endFrame() closed
+    static uint64_t getLastFrameAllocs();
+    static uint64_t getLastFrameBytes();
+
+    // Frees can't be charged to a tag (the pointer doesn't say where it came
+    // from), so they're only counted in total: since reset() and the most in a frame
+    static uint64_t getFrees();
+    static uint64_t getMaxFrameFrees();
+
+    // Allocs and bytes per frame for every tag that allocated
+    static void printReport(std::ostream& out);
+};
+
+class AllocScope {
+private:
+    int previous;
+
+public:
+    explicit AllocScope(int tag);
+    ~AllocScope();
+
+    AllocScope(const AllocScope&) = delete;
+    AllocScope& operator=(const AllocScope&) = delete;
+};
+
+#endif // ALLOC_TRACKER_H
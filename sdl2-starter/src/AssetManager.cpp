@@ -0,0 +1,195 @@
+#include "AssetManager.h"
+#include "ImageLoader.h"
+#include "Logger.h"
+#include <algorithm>
+#include <vector>
+
+AssetManager* AssetManager::instance = nullptr;
+
+AssetManager* AssetManager::getInstance() {
+    if (instance == nullptr) {
+        instance = new AssetManager();
+    }
+    return instance;
+}
+
+TextureHandle AssetManager::addTexture(const std::string& path, SDL_Renderer* renderer, SDL_Texture* raw) {
+    loads++;
+
+    TextureEntry entry;
+    entry.texture = TextureHandle(raw, SDL_DestroyTexture);
+    entry.renderer = renderer;
+    Uint32 format = 0;
+    entry.width = 0;
+    entry.height = 0;
+    SDL_QueryTexture(raw, &format, nullptr, &entry.width, &entry.height);
+    int bytesPerPixel = SDL_BYTESPERPIXEL(format) ? SDL_BYTESPERPIXEL(format) : 4;
+    entry.bytes = static_cast<size_t>(entry.width) * entry.height * bytesPerPixel;
+
+    residentBytes += entry.bytes;
+    textures[path] = entry;
+    return entry.texture;
+}
+
+TextureHandle AssetManager::getTexture(SDL_Renderer* renderer, const std::string& path) {
+    auto it = textures.find(path);
+    if (it != textures.end()) {
+        if (it->second.renderer == renderer) {
+            hits++;
+            return it->second.texture;
+        }
+
+        // Made for another renderer, so it can't be drawn with this one
+        residentBytes -= it->second.bytes;
+        textures.erase(it);
+    }
+
+    auto inFlight = pending.find(path);
+    if (inFlight != pending.end()) {
+        // Needed now: finish this one load instead of decoding the file twice
+        std::shared_ptr<DecodeJob> job = inFlight->second.job;
+        uploads.erase(std::remove(uploads.begin(), uploads.end(), job), uploads.end());
+        decoder->finish(job);
+        upload(renderer, job);
+
+        it = textures.find(path);
+        return it != textures.end() ? it->second.texture : TextureHandle();
+    }
+
+    // Fast .rgba variant or the image itself, packed or loose (see ImageLoader)
+    SDL_Surface* surface = ImageLoader::load(path);
+    if (!surface) {
+        LOG_ERROR("Failed to load texture %s: %s", path.c_str(), SDL_GetError());
+        return TextureHandle();
+    }
+    SDL_Texture* raw = SDL_CreateTextureFromSurface(renderer, surface);
+    SDL_FreeSurface(surface);
+    if (!raw) {
+        LOG_ERROR("Failed to upload texture %s: %s", path.c_str(), SDL_GetError());
+        return TextureHandle();
+    }
+    return addTexture(path, renderer, raw);
+}
+
+TextureFuture AssetManager::loadTextureAsync(const std::string& path) {
+    auto inFlight = pending.find(path);
+    if (inFlight != pending.end()) {
+        return inFlight->second.future;
+    }
+
+    TextureFuture future;
+    future.state = std::make_shared<TextureFuture::State>();
+
+    auto it = textures.find(path);
+    if (it != textures.end()) {
+        hits++;
+        future.state->texture = it->second.texture;
+        future.state->done = true;
+        return future;
+    }
+
+    if (!decoder) {
+        decoder.reset(new DecodePool(DecodePool::defaultThreadCount()));
+    }
+    pending[path] = {decoder->submit(path), future};
+    return future;
+}
+
+void AssetManager::upload(SDL_Renderer* renderer, const std::shared_ptr<DecodeJob>& job) {
+    auto inFlight = pending.find(job->path);
+    if (inFlight == pending.end() || inFlight->second.job != job) {
+        // Already handled, e.g. finished early by getTexture()
+        if (job->surface) SDL_FreeSurface(job->surface);
+        job->surface = nullptr;
+        return;
+    }
+    TextureFuture future = inFlight->second.future;
+    pending.erase(inFlight);
+
+    if (!job->surface) {
+        LOG_ERROR("Failed to load texture %s: %s", job->path.c_str(), job->error.c_str());
+    } else {
+        SDL_Texture* raw = SDL_CreateTextureFromSurface(renderer, job->surface);
+        SDL_FreeSurface(job->surface);
+        job->surface = nullptr;
+
+        if (raw) {
+            future.state->texture = addTexture(job->path, renderer, raw);
+        } else {
+            LOG_ERROR("Failed to upload texture %s: %s", job->path.c_str(), SDL_GetError());
+        }
+    }
+    future.state->done = true;
+}
+
+int AssetManager::pump(SDL_Renderer* renderer, double budgetMs) {
+    if (!decoder) return 0;
+    decoder->collect(uploads);
+    if (uploads.empty()) return 0;
+
+    Uint64 start = SDL_GetPerformanceCounter();
+    Uint64 budgetTicks = static_cast<Uint64>(budgetMs * SDL_GetPerformanceFrequency() / 1000.0);
+
+    // Uploads cost far more than reading the clock, so check after every one
+    size_t done = 0;
+    while (done < uploads.size()) {
+        upload(renderer, uploads[done]);
+        done++;
+        if (SDL_GetPerformanceCounter() - start > budgetTicks) break;
+    }
+    uploads.erase(uploads.begin(), uploads.begin() + done);
+    return static_cast<int>(done);
+}
+
+int AssetManager::purgeUnused() {
+    int purged = 0;
+    for (auto it = textures.begin(); it != textures.end(); ) {
+        // The cache's own copy is the only one left
+        if (it->second.texture.use_count() == 1) {
+            residentBytes -= it->second.bytes;
+            it = textures.erase(it);
+            purged++;
+        } else {
+            ++it;
+        }
+    }
+    return purged;
+}
+
+void AssetManager::clear() {
+    decoder.reset();  // Joins the workers; frees what they finished but nobody collected
+
+    for (auto& job : uploads) {
+        if (job->surface) SDL_FreeSurface(job->surface);
+    }
+    uploads.clear();
+    for (auto& pair : pending) {
+        pair.second.future.state->done = true;
+    }
+    pending.clear();
+
+    textures.clear();
+    residentBytes = 0;
+}
+
+void AssetManager::logReport() const {
+    // Largest first, that's where the memory is
+    std::vector<std::pair<std::string, const TextureEntry*>> sorted;
+    sorted.reserve(textures.size());
+    for (const auto& pair : textures) {
+        sorted.push_back({pair.first, &pair.second});
+    }
+    std::sort(sorted.begin(), sorted.end(),
+              [](const std::pair<std::string, const TextureEntry*>& a,
+                 const std::pair<std::string, const TextureEntry*>& b) {
+                  return a.second->bytes > b.second->bytes;
+              });
+
+    for (const auto& pair : sorted) {
+        const TextureEntry& entry = *pair.second;
+        SDL_Log("  %-40s %5dx%-5d %8.1f KB  users %ld", pair.first.c_str(), entry.width,
+                entry.height, entry.bytes / 1024.0, entry.texture.use_count() - 1);
+    }
+    SDL_Log("Textures: %d resident, %.1f KB, %d loads, %d cache hits",
+            getTextureCount(), residentBytes / 1024.0, loads, hits);
+}
@@ -0,0 +1,104 @@
+#ifndef ASSET_MANAGER_H
+#define ASSET_MANAGER_H
+
+#include <SDL2/SDL.h>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "DecodePool.h"
+
+// Shared texture handle. Copies share one SDL_Texture; hold it for as long as
+// the texture is drawn and never SDL_DestroyTexture() what get() returns.
+typedef std::shared_ptr<SDL_Texture> TextureHandle;
+
+// A texture that is still being loaded. ready() turns true once pump() has
+// uploaded it (or the load failed, in which case get() stays empty). Main thread only.
+class TextureFuture {
+private:
+    struct State {
+        TextureHandle texture;
+        bool done = false;
+    };
+    std::shared_ptr<State> state;
+
+    friend class AssetManager;
+
+public:
+    bool valid() const { return state != nullptr; }
+    bool ready() const { return state && state->done; }
+    TextureHandle get() const { return state ? state->texture : TextureHandle(); }
+};
+
+// Loads each image once and hands out shared handles to it, keyed by path.
+// Textures stay resident after their last user lets go, so a new game or a
+// second state asking for the same file gets the cached copy; purgeUnused()
+// drops the ones nobody holds. clear() must run before the renderer is destroyed.
+//
+// loadTextureAsync() decodes on a DecodePool in the background; pump() then
+// uploads finished images on the main thread within a time budget. Asking for
+// an in-flight file with getTexture() finishes that one load right away.
+class AssetManager {
+private:
+    struct TextureEntry {
+        TextureHandle texture;
+        SDL_Renderer* renderer;  // textures belong to the renderer that made them
+        int width, height;
+        size_t bytes;            // estimated GPU size, width * height * bytes per pixel
+    };
+
+    struct PendingTexture {
+        std::shared_ptr<DecodeJob> job;
+        TextureFuture future;
+    };
+
+    std::unordered_map<std::string, TextureEntry> textures;
+    std::unordered_map<std::string, PendingTexture> pending;  // submitted, not uploaded yet
+    std::vector<std::shared_ptr<DecodeJob>> uploads;           // decoded, waiting for pump()
+    std::unique_ptr<DecodePool> decoder;                       // started on the first async load
+    size_t residentBytes;
+    int loads;   // files actually read from disk
+    int hits;    // requests served from the cache
+
+    static AssetManager* instance;
+
+    AssetManager() : residentBytes(0), loads(0), hits(0) {} // Private constructor for singleton
+
+    TextureHandle addTexture(const std::string& path, SDL_Renderer* renderer, SDL_Texture* raw);
+    void upload(SDL_Renderer* renderer, const std::shared_ptr<DecodeJob>& job);
+
+public:
+    static AssetManager* getInstance();
+
+    // Shared handle to the texture at path, loading it on first use. Returns an
+    // empty handle if the file can't be loaded.
+    TextureHandle getTexture(SDL_Renderer* renderer, const std::string& path);
+
+    // Start decoding path in the background. Already cached files come back
+    // ready; a file already in flight shares the existing future.
+    TextureFuture loadTextureAsync(const std::string& path);
+
+    // Upload decoded images until budgetMs is spent (at least one per call, so
+    // loading always makes progress). Call once a frame. Returns how many were uploaded.
+    int pump(SDL_Renderer* renderer, double budgetMs);
+
+    // Files submitted but not uploaded yet
+    int getPendingCount() const { return static_cast<int>(pending.size()); }
+
+    // Destroy textures that no handle outside the cache refers to; returns how many
+    int purgeUnused();
+
+    // Stop the decode workers and destroy every cached texture. Handles still
+    // held elsewhere keep theirs alive; futures still loading resolve empty.
+    void clear();
+
+    int getTextureCount() const { return static_cast<int>(textures.size()); }
+    size_t getResidentBytes() const { return residentBytes; }
+    int getLoadCount() const { return loads; }
+    int getHitCount() const { return hits; }
+
+    // Log every resident texture with its size and user count, then the totals
+    void logReport() const;
+};
+
+#endif // ASSET_MANAGER_H
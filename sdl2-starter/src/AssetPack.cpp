@@ -0,0 +1,131 @@
+#include "AssetPack.h"
+#include "Logger.h"
+#include <algorithm>
+#include <cstring>
+
+#ifdef _WIN32
+#include <cstdio>
+#include <vector>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+AssetPack* AssetPack::instance = nullptr;
+
+AssetPack* AssetPack::getInstance() {
+    if (instance == nullptr) {
+        instance = new AssetPack();
+    }
+    return instance;
+}
+
+bool AssetPack::open(const std::string& packPath) {
+    close();
+
+#ifdef _WIN32
+    // No mmap here; one read into memory is still a single file open
+    FILE* file = fopen(packPath.c_str(), "rb");
+    if (!file) return false;
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    if (length <= 0) {
+        fclose(file);
+        return false;
+    }
+    uint8_t* buffer = new uint8_t[length];
+    size_t got = fread(buffer, 1, length, file);
+    fclose(file);
+    if (got != static_cast<size_t>(length)) {
+        delete[] buffer;
+        return false;
+    }
+    data = buffer;
+    size = static_cast<size_t>(length);
+#else
+    int fd = ::open(packPath.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        ::close(fd);
+        return false;
+    }
+    void* mapped = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);  // The mapping keeps the file alive
+    if (mapped == MAP_FAILED) return false;
+
+    data = static_cast<const uint8_t*>(mapped);
+    size = static_cast<size_t>(info.st_size);
+#endif
+
+    if (!validate()) {
+        LOG_WARN("Ignoring malformed asset pack %s", packPath.c_str());
+        close();
+        return false;
+    }
+    path = packPath;
+    return true;
+}
+
+bool AssetPack::validate() {
+    if (size < sizeof(PackHeader)) return false;
+
+    const PackHeader* header = reinterpret_cast<const PackHeader*>(data);
+    if (std::memcmp(header->magic, PACK_MAGIC, sizeof(PACK_MAGIC)) != 0) return false;
+    if (header->version != PACK_VERSION) return false;
+
+    // Index and names have to fit before anything is read from them
+    uint64_t indexEnd = sizeof(PackHeader) + static_cast<uint64_t>(header->entryCount) * sizeof(PackEntry);
+    uint64_t namesEnd = indexEnd + header->namesSize;
+    if (namesEnd > size) return false;
+
+    const PackEntry* table = reinterpret_cast<const PackEntry*>(data + sizeof(PackHeader));
+    const char* names = reinterpret_cast<const char*>(data + indexEnd);
+    entries.reserve(header->entryCount);
+    for (uint32_t i = 0; i < header->entryCount; i++) {
+        const PackEntry& entry = table[i];
+        if (static_cast<uint64_t>(entry.nameOffset) + entry.nameLength > header->namesSize) return false;
+        if (entry.offset < namesEnd || entry.size > size || entry.offset > size - entry.size) return false;
+        entries[std::string(names + entry.nameOffset, entry.nameLength)] = &entry;
+    }
+    return true;
+}
+
+void AssetPack::close() {
+    if (data) {
+#ifdef _WIN32
+        delete[] data;
+#else
+        munmap(const_cast<uint8_t*>(data), size);
+#endif
+    }
+    data = nullptr;
+    size = 0;
+    entries.clear();
+    path.clear();
+}
+
+const PackEntry* AssetPack::find(const std::string& name) const {
+    auto it = entries.find(name);
+    return it != entries.end() ? it->second : nullptr;
+}
+
+std::vector<std::string> AssetPack::getNames() const {
+    std::vector<std::string> names;
+    names.reserve(entries.size());
+    for (const auto& pair : entries) {
+        names.push_back(pair.first);
+    }
+    std::sort(names.begin(), names.end());
+    return names;
+}
+
+SDL_RWops* AssetPack::openRW(const std::string& name) const {
+    const PackEntry* entry = find(name);
+    if (!entry || entry->kind != PACK_KIND_FILE) return nullptr;
+    return SDL_RWFromConstMem(getData(*entry), static_cast<int>(entry->size));
+}
@@ -0,0 +1,52 @@
+#ifndef ASSET_PACK_H
+#define ASSET_PACK_H
+
+#include <SDL2/SDL.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "AssetPackFormat.h"
+
+// Read-only view of assets.pack. The whole file is memory-mapped once at
+// startup and assets are served straight out of the mapping through
+// SDL_RWFromConstMem, so loading an asset never opens or copies a file.
+// When no pack is open every lookup misses and callers use the loose files.
+class AssetPack {
+private:
+    const uint8_t* data;
+    size_t size;
+    std::unordered_map<std::string, const PackEntry*> entries;
+    std::string path;
+
+    static AssetPack* instance;
+
+    AssetPack() : data(nullptr), size(0) {} // Private constructor for singleton
+
+    bool validate();
+
+public:
+    static AssetPack* getInstance();
+
+    // Map the pack at packPath; false (and loose files from then on) if it's
+    // missing or malformed
+    bool open(const std::string& packPath);
+    void close();
+    bool isOpen() const { return data != nullptr; }
+
+    // Entry for name, or nullptr if the pack doesn't have it
+    const PackEntry* find(const std::string& name) const;
+    const void* getData(const PackEntry& entry) const { return data + entry.offset; }
+
+    // A read-only RWops over the packed bytes, or nullptr if name isn't packed.
+    // Pass freesrc=1 to whatever consumes it; the bytes stay mapped.
+    SDL_RWops* openRW(const std::string& name) const;
+
+    // Every entry name, sorted
+    std::vector<std::string> getNames() const;
+
+    int getEntryCount() const { return static_cast<int>(entries.size()); }
+    size_t getSize() const { return size; }
+    const std::string& getPath() const { return path; }
+};
+
+#endif // ASSET_PACK_H
@@ -0,0 +1,45 @@
+#ifndef ASSET_PACK_FORMAT_H
+#define ASSET_PACK_FORMAT_H
+
+#include <cstdint>
+
+// On-disk layout of assets.pack, shared by the game (AssetPack) and the packer
+// (tools/packassets.cpp). Everything is little-endian:
+//
+//   PackHeader
+//   PackEntry[entryCount]         sorted by name
+//   names                         namesSize bytes, not NUL-terminated
+//   blobs                         each starting on a PACK_ALIGNMENT boundary
+//
+// Entry names are the paths the game asks for, e.g. "assets/frog.png" or
+// "fonts/pixelFont.ttf", so a pack is a drop-in for the loose files.
+
+static const char PACK_MAGIC[4] = {'F', 'G', 'P', 'K'};
+static const uint32_t PACK_VERSION = 1;
+static const uint32_t PACK_ALIGNMENT = 16;
+
+// How an entry's bytes are stored
+enum PackKind : uint32_t {
+    PACK_KIND_FILE = 0  // the file exactly as it was on disk (PNG, TTF, ...)
+};
+
+struct PackHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t entryCount;
+    uint32_t namesSize;
+};
+
+struct PackEntry {
+    uint64_t offset;      // from the start of the pack
+    uint64_t size;        // bytes
+    uint32_t nameOffset;  // into the names block
+    uint32_t nameLength;
+    uint32_t kind;        // PackKind
+    uint32_t reserved;
+};
+
+static_assert(sizeof(PackHeader) == 16, "PackHeader layout changed");
+static_assert(sizeof(PackEntry) == 32, "PackEntry layout changed");
+
+#endif // ASSET_PACK_FORMAT_H
@@ -0,0 +1,104 @@
+#include "DecodePool.h"
+#include "ImageLoader.h"
+#include "Tracer.h"
+#include <algorithm>
+
+DecodePool::DecodePool(int threads) : inProgress(0), stopping(false) {
+    threads = std::max(threads, 1);
+    workers.reserve(threads);
+    for (int i = 0; i < threads; i++) {
+        workers.emplace_back(&DecodePool::workerLoop, this);
+    }
+}
+
+DecodePool::~DecodePool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    workAvailable.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    // Nobody is coming for these any more
+    for (auto& job : finished) {
+        if (job->surface) SDL_FreeSurface(job->surface);
+    }
+}
+
+void DecodePool::workerLoop() {
+    Tracer::getInstance()->setThreadName("decode worker");
+
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        workAvailable.wait(lock, [this] { return stopping || !queued.empty(); });
+        if (stopping) return;  // Queued jobs are dropped; their surfaces were never made
+
+        std::shared_ptr<DecodeJob> job = queued.front();
+        queued.pop_front();
+        inProgress++;
+
+        // The slow part, with the lock released
+        lock.unlock();
+        SDL_Surface* surface;
+        {
+            TRACE_SCOPE("asset.decode");
+            surface = ImageLoader::load(job->path);
+        }
+        std::string error = surface ? std::string() : SDL_GetError();
+        lock.lock();
+
+        job->surface = surface;
+        job->error = error;
+        job->decoded = true;
+        finished.push_back(job);
+        inProgress--;
+        jobFinished.notify_all();
+    }
+}
+
+std::shared_ptr<DecodeJob> DecodePool::submit(const std::string& path) {
+    auto job = std::make_shared<DecodeJob>();
+    job->path = path;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        queued.push_back(job);
+    }
+    workAvailable.notify_one();
+    return job;
+}
+
+void DecodePool::collect(std::vector<std::shared_ptr<DecodeJob>>& out) {
+    std::lock_guard<std::mutex> lock(mutex);
+    out.insert(out.end(), finished.begin(), finished.end());
+    finished.clear();
+}
+
+void DecodePool::finish(const std::shared_ptr<DecodeJob>& job) {
+    std::unique_lock<std::mutex> lock(mutex);
+
+    auto waiting = std::find(queued.begin(), queued.end(), job);
+    if (waiting != queued.end()) {
+        // Not started: faster to decode it now than to wait behind the queue
+        queued.erase(waiting);
+        lock.unlock();
+        job->surface = ImageLoader::load(job->path);
+        if (!job->surface) job->error = SDL_GetError();
+        job->decoded = true;
+        return;
+    }
+
+    jobFinished.wait(lock, [&job] { return job->decoded; });
+    finished.erase(std::remove(finished.begin(), finished.end(), job), finished.end());
+}
+
+int DecodePool::pending() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return static_cast<int>(queued.size()) + inProgress;
+}
+
+int DecodePool::defaultThreadCount() {
+    int cores = static_cast<int>(std::thread::hardware_concurrency());
+    return std::min(std::max(cores - 1, 1), 4);
+}
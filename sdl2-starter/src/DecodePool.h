@@ -0,0 +1,66 @@
+#ifndef DECODE_POOL_H
+#define DECODE_POOL_H
+
+#include <SDL2/SDL.h>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// One image file to decode. A worker fills in surface; whoever collects the
+// job owns the surface from then on and must SDL_FreeSurface() it.
+struct DecodeJob {
+    std::string path;
+    SDL_Surface* surface = nullptr;  // nullptr if the file couldn't be decoded
+    std::string error;               // why, copied off the worker (SDL errors are per thread)
+    bool decoded = false;
+};
+
+// Worker threads that decode images (ImageLoader::load) off the main thread.
+// Decoding only touches memory (no renderer), so it is safe here; turning the
+// surface into a texture still has to happen on the main thread. All methods
+// are called from the main thread; the workers only ever touch the queues
+// under the mutex.
+class DecodePool {
+private:
+    std::vector<std::thread> workers;
+    std::deque<std::shared_ptr<DecodeJob>> queued;     // waiting for a worker
+    std::vector<std::shared_ptr<DecodeJob>> finished;  // decoded, waiting for collect()
+    int inProgress;
+    bool stopping;
+
+    mutable std::mutex mutex;
+    std::condition_variable workAvailable;
+    std::condition_variable jobFinished;
+
+    void workerLoop();
+
+public:
+    explicit DecodePool(int threads);
+    ~DecodePool();  // Stops the workers and frees surfaces nobody collected
+
+    DecodePool(const DecodePool&) = delete;
+    DecodePool& operator=(const DecodePool&) = delete;
+
+    // Queue a file for decoding
+    std::shared_ptr<DecodeJob> submit(const std::string& path);
+
+    // Move every decoded job into out (appended). Doesn't block.
+    void collect(std::vector<std::shared_ptr<DecodeJob>>& out);
+
+    // Block until this job is decoded and take it out of the pool, so collect()
+    // won't hand it out again. A job no worker has started yet is decoded right
+    // here on the calling thread instead of waiting in line.
+    void finish(const std::shared_ptr<DecodeJob>& job);
+
+    // Jobs queued or being decoded
+    int pending() const;
+
+    // Worker count for this machine: leave a core for the main thread, cap at 4
+    static int defaultThreadCount();
+};
+
+#endif // DECODE_POOL_H
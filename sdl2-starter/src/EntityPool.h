@@ -0,0 +1,126 @@
+#ifndef ENTITY_POOL_H
+#define ENTITY_POOL_H
+
+#include <vector>
+
+// Fixed-capacity pool of game entities. Every slot is constructed once when the
+// pool is sized; acquire() hands out a free slot in O(1) and release() returns it
+// for reuse, so spawning and killing never touch the allocator or move other
+// entities. Slot addresses stay put for the life of the pool. Iteration visits
+// live slots only, in no particular order. T must be default-constructible and
+// is expected to re-initialise itself when reused.
+template <typename T>
+class EntityPool {
+private:
+    std::vector<T> slots;
+    std::vector<int> live;        // indices of live slots, packed
+    std::vector<int> livePos;     // slot -> position in live, -1 when free
+    std::vector<int> freeSlots;   // stack of unused slot indices
+
+public:
+    class iterator {
+    private:
+        EntityPool* pool;
+        int pos;
+    public:
+        iterator(EntityPool* p, int i) : pool(p), pos(i) {}
+        T& operator*() const { return pool->slots[pool->live[pos]]; }
+        T* operator->() const { return &pool->slots[pool->live[pos]]; }
+        iterator& operator++() { ++pos; return *this; }
+        bool operator!=(const iterator& other) const { return pos != other.pos; }
+    };
+
+    class const_iterator {
+    private:
+        const EntityPool* pool;
+        int pos;
+    public:
+        const_iterator(const EntityPool* p, int i) : pool(p), pos(i) {}
+        const T& operator*() const { return pool->slots[pool->live[pos]]; }
+        const T* operator->() const { return &pool->slots[pool->live[pos]]; }
+        const_iterator& operator++() { ++pos; return *this; }
+        bool operator!=(const const_iterator& other) const { return pos != other.pos; }
+    };
+
+    explicit EntityPool(int capacity = 0) {
+        resize(capacity);
+    }
+
+    // Size the pool; drops every live entity. Meant for load time (gameplay::Init).
+    void resize(int capacity) {
+        slots.clear();
+        slots.resize(capacity);
+        live.clear();
+        live.reserve(capacity);
+        livePos.assign(capacity, -1);
+        freeSlots.clear();
+        freeSlots.reserve(capacity);
+
+        // Hand out low slots first
+        for (int i = capacity - 1; i >= 0; i--) {
+            freeSlots.push_back(i);
+        }
+    }
+
+    // A free slot, still holding whatever its last occupant left; nullptr when full
+    T* acquire() {
+        if (freeSlots.empty()) return nullptr;
+
+        int slot = freeSlots.back();
+        freeSlots.pop_back();
+        livePos[slot] = static_cast<int>(live.size());
+        live.push_back(slot);
+        return &slots[slot];
+    }
+
+    // Return the entity's slot to the pool
+    void release(T* entity) {
+        int slot = static_cast<int>(entity - slots.data());
+        int pos = livePos[slot];
+        if (pos < 0) return;
+
+        // Swap the last live index into the hole
+        int last = live.back();
+        live[pos] = last;
+        livePos[last] = pos;
+        live.pop_back();
+
+        livePos[slot] = -1;
+        freeSlots.push_back(slot);
+    }
+
+    // Release every live entity matching pred in one pass
+    template <typename Pred>
+    void releaseIf(Pred pred) {
+        for (int pos = 0; pos < static_cast<int>(live.size()); ) {
+            T& entity = slots[live[pos]];
+            if (pred(entity)) {
+                release(&entity);  // Re-check pos, it now holds the moved index
+            } else {
+                ++pos;
+            }
+        }
+    }
+
+    void clear() {
+        while (!live.empty()) {
+            release(&slots[live.back()]);
+        }
+    }
+
+    // i-th live entity; positions shift when something is released
+    T& operator[](int i) { return slots[live[i]]; }
+    const T& operator[](int i) const { return slots[live[i]]; }
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, static_cast<int>(live.size())); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, static_cast<int>(live.size())); }
+
+    int size() const { return static_cast<int>(live.size()); }
+    int capacity() const { return static_cast<int>(slots.size()); }
+    bool full() const { return freeSlots.empty(); }
+    bool empty() const { return live.empty(); }
+};
+
+#endif // ENTITY_POOL_H
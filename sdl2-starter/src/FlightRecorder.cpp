@@ -0,0 +1,207 @@
+#include "FlightRecorder.h"
+#include "Profiler.h"
+#include "Logger.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+static const int WORST_SCOPES = 5;  // listed with the hitch frame
+
+// Key names can be a quote or a backslash
+static void writeString(FILE* file, const char* text) {
+    fputc('"', file);
+    for (; *text; text++) {
+        if (*text == '"' || *text == '\\') fputc('\\', file);
+        fputc(*text, file);
+    }
+    fputc('"', file);
+}
+
+FlightRecorder* FlightRecorder::instance = nullptr;
+
+FlightRecorder* FlightRecorder::getInstance() {
+    if (instance == nullptr) {
+        instance = new FlightRecorder();
+    }
+    return instance;
+}
+
+FlightRecorder::FlightRecorder()
+    : active(false), frameCount(0), inputCount(0), counterCount(0), startTicks(0), lastFrameEnd(0),
+      lastDumpFrame(0), dumps(0) {}
+
+void FlightRecorder::start(const Config& cfg) {
+    config = cfg;
+    if (config.budgetMs <= 0.0 || config.windowFrames <= 0) {
+        stop();
+        return;
+    }
+
+    frames.assign(config.windowFrames, Frame());
+    inputs.assign(MAX_INPUTS, Input());
+    frameCount = 0;
+    inputCount = 0;
+    counterCount = 0;
+    std::fill(counterValues, counterValues + MAX_COUNTERS, 0.0);
+    startTicks = SDL_GetPerformanceCounter();
+    lastFrameEnd = 0;
+    lastDumpFrame = -config.windowFrames;
+    dumps = 0;
+    active = true;
+    Profiler::getInstance()->setTiming(true);
+}
+
+void FlightRecorder::stop() {
+    active = false;
+    Profiler::getInstance()->setTiming(false);
+}
+
+double FlightRecorder::elapsedMs(Uint64 ticks) const {
+    return (ticks - startTicks) * 1000.0 / SDL_GetPerformanceFrequency();
+}
+
+void FlightRecorder::setCounter(const char* name, double value) {
+    if (!active) return;
+    for (int i = 0; i < counterCount; i++) {
+        if (counterNames[i] == name || std::strcmp(counterNames[i], name) == 0) {
+            counterValues[i] = value;
+            return;
+        }
+    }
+    if (counterCount == MAX_COUNTERS) return;
+    counterNames[counterCount] = name;
+    counterValues[counterCount++] = value;
+}
+
+void FlightRecorder::recordEvent(const SDL_Event& event) {
+    if (!active) return;
+    if (event.type != SDL_KEYDOWN && event.type != SDL_KEYUP &&
+        event.type != SDL_MOUSEBUTTONDOWN && event.type != SDL_MOUSEBUTTONUP) {
+        return;
+    }
+    if ((event.type == SDL_KEYDOWN || event.type == SDL_KEYUP) && event.key.repeat) return;
+
+    Input& input = inputs[inputCount % MAX_INPUTS];
+    input.frame = frameCount;
+    input.timeMs = elapsedMs(SDL_GetPerformanceCounter());
+    input.type = event.type;
+    if (event.type == SDL_KEYDOWN || event.type == SDL_KEYUP) {
+        input.key = event.key.keysym.sym;
+        input.button = input.x = input.y = 0;
+    } else {
+        input.key = 0;
+        input.button = event.button.button;
+        input.x = event.button.x;
+        input.y = event.button.y;
+    }
+    inputCount++;
+}
+
+void FlightRecorder::endFrame() {
+    if (!active) return;
+
+    Uint64 now = SDL_GetPerformanceCounter();
+    Profiler* profiler = Profiler::getInstance();
+
+    Frame& frame = frames[frameCount % config.windowFrames];
+    frame.index = frameCount;
+    frame.timeMs = elapsedMs(now);
+    frame.frameMs = lastFrameEnd != 0 ? (now - lastFrameEnd) * 1000.0 / SDL_GetPerformanceFrequency() : 0.0;
+    frame.scopeCount = std::min(profiler->getScopeCount(), static_cast<int>(MAX_SCOPES));
+    for (int i = 0; i < frame.scopeCount; i++) {
+        frame.scopeMs[i] = static_cast<float>(profiler->getFrameMs(i));
+    }
+    std::copy(counterValues, counterValues + MAX_COUNTERS, frame.counters);
+    lastFrameEnd = now;
+    frameCount++;
+
+    // At most one dump per window, so a burst of slow frames (a level load)
+    // writes one file rather than ten
+    if (frame.frameMs > config.budgetMs && dumps < MAX_DUMPS &&
+        frame.index - lastDumpFrame >= config.windowFrames) {
+        dump(frame);
+        lastDumpFrame = frame.index;
+        dumps++;
+        lastFrameEnd = SDL_GetPerformanceCounter();  // Writing the file isn't the next frame's fault
+    }
+}
+
+void FlightRecorder::dump(const Frame& hitch) {
+    char path[512];
+    snprintf(path, sizeof(path), "%s_%06d.json", config.prefix.c_str(), hitch.index);
+    FILE* file = fopen(path, "w");
+    if (!file) {
+        LOG_ERROR("Frame %d took %.1f ms, but couldn't write %s", hitch.index, hitch.frameMs, path);
+        return;
+    }
+
+    Profiler* profiler = Profiler::getInstance();
+
+    // Slowest sections of the hitch frame first: usually the answer
+    int order[MAX_SCOPES];
+    for (int i = 0; i < hitch.scopeCount; i++) order[i] = i;
+    std::sort(order, order + hitch.scopeCount, [&](int a, int b) { return hitch.scopeMs[a] > hitch.scopeMs[b]; });
+
+    // Time no section accounts for: loading, present, or a spot nobody profiled yet
+    double profiledMs = 0.0;
+    for (int i = 0; i < hitch.scopeCount; i++) profiledMs += hitch.scopeMs[i];
+
+    fprintf(file, "{\n  \"hitch\": {\"frame\": %d, \"time_ms\": %.3f, \"frame_ms\": %.3f, \"budget_ms\": %.3f, "
+                  "\"outside_sections_ms\": %.3f, \"slowest\": {", hitch.index, hitch.timeMs, hitch.frameMs,
+            config.budgetMs, std::max(0.0, hitch.frameMs - profiledMs));
+    for (int i = 0; i < std::min(hitch.scopeCount, WORST_SCOPES); i++) {
+        fprintf(file, "%s\"%s\": %.3f", i == 0 ? "" : ", ", profiler->getName(order[i]), hitch.scopeMs[order[i]]);
+    }
+    fprintf(file, "}},\n");
+
+    // The window, oldest frame first
+    int oldest = std::max(0, frameCount - config.windowFrames);
+    fprintf(file, "  \"frames\": [");
+    for (int index = oldest; index < frameCount; index++) {
+        const Frame& frame = frames[index % config.windowFrames];
+        fprintf(file, "%s\n    {\"frame\": %d, \"time_ms\": %.3f, \"frame_ms\": %.3f, \"sections_ms\": {",
+                index == oldest ? "" : ",", frame.index, frame.timeMs, frame.frameMs);
+        bool first = true;
+        for (int i = 0; i < frame.scopeCount; i++) {
+            if (frame.scopeMs[i] <= 0.0f) continue;  // didn't run
+            fprintf(file, "%s\"%s\": %.3f", first ? "" : ", ", profiler->getName(i), frame.scopeMs[i]);
+            first = false;
+        }
+        fprintf(file, "}, \"counts\": {");
+        for (int i = 0; i < counterCount; i++) {
+            fprintf(file, "%s\"%s\": %g", i == 0 ? "" : ", ", counterNames[i], frame.counters[i]);
+        }
+        fprintf(file, "}}");
+    }
+    fprintf(file, "\n  ],\n");
+
+    // Input in the window, oldest first
+    fprintf(file, "  \"inputs\": [");
+    bool first = true;
+    for (int i = std::max(0, inputCount - MAX_INPUTS); i < inputCount; i++) {
+        const Input& input = inputs[i % MAX_INPUTS];
+        if (input.frame < oldest) continue;
+        const char* type = input.type == SDL_KEYDOWN ? "key_down" : input.type == SDL_KEYUP ? "key_up"
+                         : input.type == SDL_MOUSEBUTTONDOWN ? "button_down" : "button_up";
+        fprintf(file, "%s\n    {\"frame\": %d, \"time_ms\": %.3f, \"type\": \"%s\", ", first ? "" : ",",
+                input.frame, input.timeMs, type);
+        if (input.key != 0) {
+            fprintf(file, "\"key\": ");
+            writeString(file, SDL_GetKeyName(input.key));
+            fprintf(file, "}");
+        } else {
+            fprintf(file, "\"button\": %d, \"x\": %d, \"y\": %d}", input.button, input.x, input.y);
+        }
+        first = false;
+    }
+    fprintf(file, "\n  ]\n}\n");
+
+    bool ok = ferror(file) == 0;
+    fclose(file);
+    if (ok) {
+        LOG_WARN("Frame %d took %.1f ms (budget %.1f ms); wrote %s", hitch.index, hitch.frameMs,
+                 config.budgetMs, path);
+    } else {
+        LOG_ERROR("Frame %d took %.1f ms, but writing %s failed", hitch.index, hitch.frameMs, path);
+    }
+}
@@ -0,0 +1,89 @@
+#ifndef FLIGHT_RECORDER_H
+#define FLIGHT_RECORDER_H
+
+#include <SDL2/SDL.h>
+#include <string>
+#include <vector>
+
+// Always-on record of the last few seconds: per frame, the time in every
+// PROFILE_SCOPE section and the entity counts set through setCounter(), plus
+// the keyboard and mouse button events in between. When a frame goes over the
+// hitch budget the whole window is written out as JSON (hitch frame first,
+// with its slowest sections), so a spike comes with what led up to it.
+//
+// Everything is preallocated in start(); recording a frame is a copy of a few
+// hundred bytes into a ring. Main thread only.
+class FlightRecorder {
+public:
+    static const int MAX_SCOPES = 64;
+    static const int MAX_COUNTERS = 8;
+    static const int MAX_INPUTS = 512;   // input events kept, across the whole window
+    static const int MAX_DUMPS = 10;     // per run, so a slow machine doesn't fill the disk
+
+    struct Config {
+        double budgetMs = 50.0;          // frames slower than this are hitches; 0 turns recording off
+        int windowFrames = 300;          // about five seconds at 60 fps
+        std::string prefix = "hitch";    // dumps go to <prefix>_<frame>.json
+    };
+
+private:
+    struct Frame {
+        int index;
+        double timeMs;                   // since start()
+        double frameMs;                  // present to present
+        int scopeCount;
+        float scopeMs[MAX_SCOPES];
+        double counters[MAX_COUNTERS];
+    };
+
+    struct Input {
+        int frame;
+        double timeMs;
+        Uint32 type;
+        SDL_Keycode key;                 // key events
+        int button, x, y;                // mouse button events
+    };
+
+    Config config;
+    bool active;
+
+    std::vector<Frame> frames;           // ring, windowFrames long
+    int frameCount;                      // frames closed since start()
+    std::vector<Input> inputs;           // ring, MAX_INPUTS long
+    int inputCount;
+
+    const char* counterNames[MAX_COUNTERS];
+    double counterValues[MAX_COUNTERS];
+    int counterCount;
+
+    Uint64 startTicks;
+    Uint64 lastFrameEnd;
+    int lastDumpFrame;
+    int dumps;
+
+    static FlightRecorder* instance;
+
+    FlightRecorder();  // Private constructor for singleton
+
+    double elapsedMs(Uint64 ticks) const;
+    void dump(const Frame& hitch);
+
+public:
+    static FlightRecorder* getInstance();
+
+    void start(const Config& cfg);
+    void stop();
+    bool isActive() const { return active; }
+
+    // Value of a named count for the frame being recorded; name must be a literal
+    void setCounter(const char* name, double value);
+
+    // Key presses/releases and mouse clicks; everything else is ignored
+    void recordEvent(const SDL_Event& event);
+
+    // Close a frame, just before the profiler does: keep its numbers and dump
+    // the window if it was a hitch
+    void endFrame();
+};
+
+#endif // FLIGHT_RECORDER_H
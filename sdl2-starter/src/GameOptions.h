@@ -0,0 +1,21 @@
+#ifndef GAME_OPTIONS_H
+#define GAME_OPTIONS_H
+
+#include <cstdint>
+
+// Options picked on the command line that change how a match plays
+struct GameOptions {
+    bool swarmMode = false;       // Wasps flock with boids steering instead of beelining
+    int waspsPerSpawn = 3;        // Wasps added each spawn tick
+    bool pipelined = true;        // Simulate on a second thread while the last tick draws (SimulationThread.h)
+    int spriteCache = -1;         // Baked sprite rotations and flips (render/SpriteCache.h): -1 on the software renderer, 0 off, 1 on
+
+    // Set by scenario runs (see bench/ScenarioState.h); the defaults are a normal match
+    uint32_t seed = 0;            // Map, spawns and turtle wandering; 0 picks a random seed
+    int maxWasps = -1;            // Wasp budget, -1 keeps the SpawnDirector's
+    int maxTurtles = -1;          // Turtle budget, -1 keeps the SpawnDirector's
+    int rainDrops = -1;           // Drops on screen, 0 for none, -1 for the usual drizzle
+    bool invulnerable = false;    // Frog ignores damage so a long run never ends in game over
+};
+
+#endif // GAME_OPTIONS_H
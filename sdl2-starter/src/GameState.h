@@ -8,7 +8,7 @@ Description: A Game State class. This class represents other classes derived fro
 
 Subsequent changes:
 Format: [Author] - [Changes]
-- 
+- Added RenderHUD for what stays at full resolution when the scene is rendered low-res
 *********************************************/
 
 #include <SDL2/SDL.h>
@@ -20,6 +20,8 @@ public:
     virtual void HandleEvents(SDL_Event& event) = 0;
     virtual void Update(float deltaTime) = 0;
     virtual void Render(SDL_Renderer* renderer) = 0;
+    // Drawn after Render, straight to the window even when the scene goes through a LowResTarget
+    virtual void RenderHUD(SDL_Renderer* renderer) {}
     virtual void CleanUp() = 0;
     virtual ~GameState() {}
 };
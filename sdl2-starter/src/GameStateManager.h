@@ -8,6 +8,7 @@ Description: The Game State Manager class. Handles switching between states, and
 Subsequent changes:
 Format: [Author] - [Changes]
 - Added header guards
+- RenderHUD passes the full-resolution pass on to the current state
 *********************************************/
 
 #include <stack>
@@ -68,6 +69,12 @@ public:
         }
     }
 
+    void RenderHUD(SDL_Renderer* renderer) {
+        if (!states.empty()) {
+            states.top()->RenderHUD(renderer);
+        }
+    }
+
     // Clean up all states
     ~GameStateManager() {
         while (!states.empty()) {
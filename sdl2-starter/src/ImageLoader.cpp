@@ -0,0 +1,98 @@
+#include "ImageLoader.h"
+#include "AssetPack.h"
+#include "RawImageFormat.h"
+#include <SDL2/SDL_image.h>
+#include <cstring>
+
+static bool preferFast = true;
+
+// Header sanity shared by the packed and loose paths
+static bool validHeader(const RawImageHeader& header) {
+    return std::memcmp(header.magic, RAW_IMAGE_MAGIC, sizeof(RAW_IMAGE_MAGIC)) == 0 &&
+           header.version == RAW_IMAGE_VERSION &&
+           header.width > 0 && header.width <= RAW_IMAGE_MAX_SIZE &&
+           header.height > 0 && header.height <= RAW_IMAGE_MAX_SIZE;
+}
+
+// A surface over the packed pixels themselves; SDL_CreateTextureFromSurface only reads them
+static SDL_Surface* wrapPacked(const PackEntry& entry) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(AssetPack::getInstance()->getData(entry));
+    if (entry.size < sizeof(RawImageHeader)) return nullptr;
+
+    RawImageHeader header;
+    std::memcpy(&header, bytes, sizeof(header));
+    if (!validHeader(header)) return nullptr;
+
+    uint64_t pixelBytes = static_cast<uint64_t>(header.width) * header.height * 4;
+    if (entry.size - sizeof(RawImageHeader) < pixelBytes) return nullptr;
+
+    void* pixels = const_cast<uint8_t*>(bytes + sizeof(RawImageHeader));
+    return SDL_CreateRGBSurfaceWithFormatFrom(pixels, header.width, header.height, 32,
+                                              header.width * 4, SDL_PIXELFORMAT_RGBA32);
+}
+
+SDL_Surface* ImageLoader::loadRaw(SDL_RWops* src, int freesrc) {
+    if (!src) return nullptr;
+
+    SDL_Surface* surface = nullptr;
+    RawImageHeader header;
+    if (SDL_RWread(src, &header, sizeof(header), 1) == 1 && validHeader(header)) {
+        surface = SDL_CreateRGBSurfaceWithFormat(0, header.width, header.height, 32,
+                                                 SDL_PIXELFORMAT_RGBA32);
+    }
+
+    if (surface) {
+        // SDL may pad rows, the file never does
+        size_t rowBytes = header.width * 4;
+        uint8_t* row = static_cast<uint8_t*>(surface->pixels);
+        for (uint32_t y = 0; y < header.height; y++, row += surface->pitch) {
+            if (SDL_RWread(src, row, rowBytes, 1) != 1) {
+                SDL_FreeSurface(surface);
+                surface = nullptr;
+                break;
+            }
+        }
+    }
+
+    if (freesrc) SDL_RWclose(src);
+    return surface;
+}
+
+std::string ImageLoader::fastVariantPath(const std::string& path) {
+    size_t dot = path.find_last_of('.');
+    size_t slash = path.find_last_of('/');
+    if (dot == std::string::npos || (slash != std::string::npos && dot < slash)) {
+        return std::string();
+    }
+    return path.substr(0, dot) + ".rgba";
+}
+
+SDL_Surface* ImageLoader::load(const std::string& path, bool* usedFast) {
+    AssetPack* pack = AssetPack::getInstance();
+    if (usedFast) *usedFast = false;
+
+    std::string fastPath = preferFast ? fastVariantPath(path) : std::string();
+    if (!fastPath.empty() && fastPath != path) {
+        SDL_Surface* surface = nullptr;
+        if (const PackEntry* entry = pack->find(fastPath)) {
+            surface = wrapPacked(*entry);
+        } else if (SDL_RWops* file = SDL_RWFromFile(fastPath.c_str(), "rb")) {
+            surface = loadRaw(file, 1);
+        }
+        if (surface) {
+            if (usedFast) *usedFast = true;
+            return surface;
+        }
+    }
+
+    SDL_RWops* packed = pack->openRW(path);
+    return packed ? IMG_Load_RW(packed, 1) : IMG_Load(path.c_str());
+}
+
+void ImageLoader::setPreferFast(bool prefer) {
+    preferFast = prefer;
+}
+
+bool ImageLoader::getPreferFast() {
+    return preferFast;
+}
@@ -0,0 +1,30 @@
+#ifndef IMAGE_LOADER_H
+#define IMAGE_LOADER_H
+
+#include <SDL2/SDL.h>
+#include <string>
+
+// Turns an image path into a surface, looking in this order:
+//   1. the .rgba fast variant in assets.pack (wrapped in place, no copy)
+//   2. the .rgba fast variant as a loose file
+//   3. the image itself in assets.pack
+//   4. the image itself as a loose file (IMG_Load)
+// Safe to call from the decode workers. A surface from (1) points into the
+// pack's mapping: never write to its pixels, and free it before the pack closes.
+namespace ImageLoader {
+    // usedFast, if given, is set to whether a .rgba variant was used
+    SDL_Surface* load(const std::string& path, bool* usedFast = nullptr);
+
+    // "assets/wasp.png" -> "assets/wasp.rgba"; empty if path has no extension
+    std::string fastVariantPath(const std::string& path);
+
+    // Read a .rgba image from src into a new surface; nullptr if it's malformed
+    SDL_Surface* loadRaw(SDL_RWops* src, int freesrc);
+
+    // On by default; the load benchmark turns it off to time the PNGs.
+    // Only change it while nothing is loading.
+    void setPreferFast(bool prefer);
+    bool getPreferFast();
+}
+
+#endif // IMAGE_LOADER_H
@@ -0,0 +1,151 @@
+#include "Logger.h"
+#include <cstdarg>
+#include <cstring>
+
+Logger* Logger::instance = nullptr;
+
+const int Logger::MESSAGE_SIZE;
+const int Logger::RING_SIZE;
+
+static const char* const LEVEL_NAMES[] = {"DEBUG", "INFO ", "WARN ", "ERROR"};
+static const int IDLE_SLEEP_MS = 5;  // writer's nap when the ring is empty
+
+static std::atomic<int> nextThreadNumber(0);
+static thread_local int threadNumber = -1;
+
+Logger* Logger::getInstance() {
+    if (instance == nullptr) {
+        instance = new Logger();
+    }
+    return instance;
+}
+
+Logger::Logger()
+    : enqueuePos(0), dequeuePos(0), dropped(0), startTime(std::chrono::steady_clock::now()),
+      running(false), output(stderr), ownsOutput(false) {
+    // Slot i is free for the producer whose ticket is i
+    for (int i = 0; i < RING_SIZE; i++) {
+        ring[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+// Reserve the next slot, or nullptr if the writer is a full ring behind
+Logger::Record* Logger::claim() {
+    uint64_t pos = enqueuePos.load(std::memory_order_relaxed);
+    while (true) {
+        Record* record = &ring[pos & (RING_SIZE - 1)];
+        uint64_t sequence = record->sequence.load(std::memory_order_acquire);
+        int64_t diff = static_cast<int64_t>(sequence) - static_cast<int64_t>(pos);
+        if (diff == 0) {
+            // Free; take it unless another producer got there first
+            if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                return record;
+            }
+        } else if (diff < 0) {
+            return nullptr;  // Still holds an unwritten message from a lap ago
+        } else {
+            pos = enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void Logger::write(int level, const char* file, int line, const char* format, ...) {
+    Record* record = claim();
+    if (!record) {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    if (threadNumber < 0) {
+        threadNumber = nextThreadNumber.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    record->micros = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - startTime).count();
+    record->file = file;
+    record->line = line;
+    record->level = level;
+    record->thread = threadNumber;
+
+    va_list args;
+    va_start(args, format);
+    vsnprintf(record->message, MESSAGE_SIZE, format, args);
+    va_end(args);
+
+    // Publish: the writer sees the slot as full once the sequence moves past pos
+    uint64_t pos = record->sequence.load(std::memory_order_relaxed);
+    record->sequence.store(pos + 1, std::memory_order_release);
+}
+
+// Write out the oldest message, if one is ready
+bool Logger::drainOne() {
+    Record* record = &ring[dequeuePos & (RING_SIZE - 1)];
+    uint64_t sequence = record->sequence.load(std::memory_order_acquire);
+    if (sequence != dequeuePos + 1) return false;
+
+    format(*record);
+
+    // Hand the slot back to producers for the next lap
+    record->sequence.store(dequeuePos + RING_SIZE, std::memory_order_release);
+    dequeuePos++;
+    return true;
+}
+
+void Logger::format(const Record& record) {
+    const char* file = std::strrchr(record.file, '/');
+    file = file ? file + 1 : record.file;
+    int level = record.level < 0 ? 0 : (record.level > LOG_LEVEL_ERROR ? LOG_LEVEL_ERROR : record.level);
+
+    fprintf(output, "[%8.3f] %s t%d %s:%d  %s\n", record.micros / 1000000.0, LEVEL_NAMES[level],
+            record.thread, file, record.line, record.message);
+}
+
+void Logger::writerLoop() {
+    uint64_t droppedReported = 0;
+    while (true) {
+        // Read the flag first so a stop() can't slip in between the last
+        // drain and the exit
+        bool stopping = !running.load(std::memory_order_acquire);
+
+        int written = 0;
+        while (drainOne()) written++;
+
+        uint64_t droppedNow = dropped.load(std::memory_order_relaxed);
+        if (droppedNow != droppedReported) {
+            fprintf(output, "[logger] ring was full, dropped %llu messages\n",
+                    static_cast<unsigned long long>(droppedNow - droppedReported));
+            droppedReported = droppedNow;
+            written++;
+        }
+        if (written > 0) fflush(output);
+
+        if (stopping) return;
+        if (written == 0) std::this_thread::sleep_for(std::chrono::milliseconds(IDLE_SLEEP_MS));
+    }
+}
+
+void Logger::start(const char* path) {
+    if (running.load()) return;
+
+    if (path) {
+        FILE* file = fopen(path, "a");
+        if (file) {
+            output = file;
+            ownsOutput = true;
+        } else {
+            fprintf(stderr, "Can't open log file %s, logging to stderr\n", path);
+        }
+    }
+    running.store(true, std::memory_order_release);
+    writer = std::thread(&Logger::writerLoop, this);
+}
+
+void Logger::stop() {
+    if (!running.load()) return;
+
+    running.store(false, std::memory_order_release);
+    writer.join();
+
+    if (ownsOutput) fclose(output);
+    output = stderr;
+    ownsOutput = false;
+}
@@ -0,0 +1,100 @@
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+
+// Levels, lowest first. LOG_MIN_LEVEL picks the lowest one compiled in; calls
+// below it are dead code (arguments included) and vanish from the binary.
+#define LOG_LEVEL_DEBUG 0
+#define LOG_LEVEL_INFO  1
+#define LOG_LEVEL_WARN  2
+#define LOG_LEVEL_ERROR 3
+#define LOG_LEVEL_OFF   4
+
+#ifndef LOG_MIN_LEVEL
+#ifdef NDEBUG
+#define LOG_MIN_LEVEL LOG_LEVEL_INFO
+#else
+#define LOG_MIN_LEVEL LOG_LEVEL_DEBUG
+#endif
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define LOG_PRINTF_FORMAT(formatIndex, firstArg) __attribute__((format(printf, formatIndex, firstArg)))
+#else
+#define LOG_PRINTF_FORMAT(formatIndex, firstArg)
+#endif
+
+#define LOG_AT(level, ...) \
+    do { \
+        if ((level) >= LOG_MIN_LEVEL) Logger::getInstance()->write((level), __FILE__, __LINE__, __VA_ARGS__); \
+    } while (0)
+
+// printf-style: LOG_DEBUG("dx: %d, dy: %d", dx, dy)
+#define LOG_DEBUG(...) LOG_AT(LOG_LEVEL_DEBUG, __VA_ARGS__)
+#define LOG_INFO(...)  LOG_AT(LOG_LEVEL_INFO, __VA_ARGS__)
+#define LOG_WARN(...)  LOG_AT(LOG_LEVEL_WARN, __VA_ARGS__)
+#define LOG_ERROR(...) LOG_AT(LOG_LEVEL_ERROR, __VA_ARGS__)
+
+// Asynchronous logger. Any thread formats its message into a fixed-size slot
+// of a lock-free ring (Vyukov's bounded queue, many producers, one consumer)
+// and goes on; a background thread drains the ring and does the actual
+// writing, so a log call on the game thread never blocks or makes a syscall.
+// If the ring is full the message is dropped and counted rather than waiting.
+// Messages logged before start() wait in the ring until it runs.
+class Logger {
+public:
+    static const int MESSAGE_SIZE = 208;  // longer messages are cut off
+    static const int RING_SIZE = 1024;    // slots, power of two
+
+private:
+    struct Record {
+        std::atomic<uint64_t> sequence;
+        int64_t micros;       // since the logger was created
+        const char* file;     // __FILE__, a literal, so only the pointer is kept
+        int line;
+        int level;
+        int thread;           // small per-thread number, 0 for the first to log
+        char message[MESSAGE_SIZE];
+    };
+
+    Record ring[RING_SIZE];
+    std::atomic<uint64_t> enqueuePos;
+    uint64_t dequeuePos;      // only the writer thread touches this
+    std::atomic<uint64_t> dropped;
+
+    std::chrono::steady_clock::time_point startTime;
+    std::thread writer;
+    std::atomic<bool> running;
+    FILE* output;
+    bool ownsOutput;
+
+    static Logger* instance;
+
+    Logger();  // Private constructor for singleton
+
+    Record* claim();
+    bool drainOne();
+    void format(const Record& record);
+    void writerLoop();
+
+public:
+    static Logger* getInstance();
+
+    // Start the writer thread, writing to path (appended) or stderr if path is
+    // null or can't be opened
+    void start(const char* path = nullptr);
+
+    // Write out everything logged so far and join the writer thread
+    void stop();
+
+    void write(int level, const char* file, int line, const char* format, ...) LOG_PRINTF_FORMAT(5, 6);
+
+    uint64_t getDropped() const { return dropped.load(std::memory_order_relaxed); }
+};
+
+#endif // LOGGER_H
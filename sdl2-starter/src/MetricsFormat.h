@@ -0,0 +1,51 @@
+#ifndef METRICS_FORMAT_H
+#define METRICS_FORMAT_H
+
+#include <atomic>
+#include <cstdint>
+
+// Layout of the shared-memory segment the game publishes live metrics into,
+// shared by the game (MetricsPublisher) and the reader (tools/metricsreader.cpp).
+// The game rewrites the snapshot once a second under a sequence lock: sequence
+// is odd while a write is in progress, and a reader whose copy saw the number
+// change (or saw it odd) copies again. Readers never block the game.
+
+static const char METRICS_MAGIC[4] = {'F', 'G', 'M', 'T'};
+static const uint32_t METRICS_VERSION = 1;
+static const char METRICS_DEFAULT_NAME[] = "/froggun-metrics";  // shm_open name
+static const int METRICS_MAX_COUNTERS = 16;
+static const int METRICS_NAME_SIZE = 32;
+
+struct MetricsCounter {
+    char name[METRICS_NAME_SIZE];  // NUL-terminated, e.g. "wasps"
+    double value;
+};
+
+// Everything below sequence is plain data, copied as a whole by readers
+struct MetricsSnapshot {
+    uint64_t publishCount;      // snapshots so far
+    uint64_t frames;            // since the game started
+    double uptimeSeconds;
+    double intervalSeconds;     // covered by the numbers below
+    double fps;
+    double frameMsMean;
+    double frameMsP50;
+    double frameMsP95;
+    double frameMsP99;
+    double frameMsMax;
+    double allocsPerSecond;     // main thread heap allocations (AllocTracker), 0 if compiled out
+    double allocBytesPerSecond;
+    int32_t pid;
+    int32_t counterCount;
+    MetricsCounter counters[METRICS_MAX_COUNTERS];
+};
+
+struct MetricsSegment {
+    char magic[4];
+    uint32_t version;
+    std::atomic<uint32_t> sequence;
+    uint32_t reserved;
+    MetricsSnapshot snapshot;
+};
+
+#endif // METRICS_FORMAT_H
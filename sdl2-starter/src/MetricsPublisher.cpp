@@ -0,0 +1,168 @@
+#include "MetricsPublisher.h"
+#include "AllocTracker.h"
+#include "Logger.h"
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+MetricsPublisher* MetricsPublisher::instance = nullptr;
+
+MetricsPublisher* MetricsPublisher::getInstance() {
+    if (instance == nullptr) {
+        instance = new MetricsPublisher();
+    }
+    return instance;
+}
+
+MetricsPublisher::MetricsPublisher()
+    : segment(nullptr), counterCount(0), startTicks(0), intervalStart(0), lastFrameEnd(0), frames(0),
+      intervalFrames(0), intervalAllocs(0), intervalBytes(0), publishCount(0) {
+    frameMs.reserve(MAX_FRAME_SAMPLES);
+    sorted.reserve(MAX_FRAME_SAMPLES);
+}
+
+bool MetricsPublisher::start(const std::string& shmName) {
+    if (segment) return true;
+
+#ifdef _WIN32
+    LOG_WARN("Live metrics need POSIX shared memory; not publishing %s", shmName.c_str());
+    return false;
+#else
+    int fd = shm_open(shmName.c_str(), O_CREAT | O_RDWR, 0600);  // This user only
+    if (fd < 0) {
+        LOG_ERROR("Couldn't create shared memory %s", shmName.c_str());
+        return false;
+    }
+    if (ftruncate(fd, sizeof(MetricsSegment)) != 0) {
+        LOG_ERROR("Couldn't size shared memory %s", shmName.c_str());
+        close(fd);
+        return false;
+    }
+    void* mapped = mmap(nullptr, sizeof(MetricsSegment), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);  // The mapping keeps the segment
+    if (mapped == MAP_FAILED) {
+        LOG_ERROR("Couldn't map shared memory %s", shmName.c_str());
+        return false;
+    }
+
+    // Zeroed with an even sequence, so readers see an empty snapshot until the first publish
+    segment = new (mapped) MetricsSegment();
+    std::memset(&segment->snapshot, 0, sizeof(segment->snapshot));
+    segment->sequence.store(0, std::memory_order_relaxed);
+    std::memcpy(segment->magic, METRICS_MAGIC, sizeof(METRICS_MAGIC));
+    segment->version = METRICS_VERSION;
+    segment->reserved = 0;
+
+    name = shmName;
+    startTicks = SDL_GetPerformanceCounter();
+    intervalStart = startTicks;
+    lastFrameEnd = 0;
+    frames = 0;
+    frameMs.clear();
+    intervalFrames = 0;
+    intervalAllocs = 0;
+    intervalBytes = 0;
+    publishCount = 0;
+    LOG_INFO("Publishing live metrics to shared memory %s", name.c_str());
+    return true;
+#endif
+}
+
+void MetricsPublisher::stop() {
+#ifndef _WIN32
+    if (!segment) return;
+    munmap(segment, sizeof(MetricsSegment));
+    shm_unlink(name.c_str());
+    segment = nullptr;
+#endif
+}
+
+void MetricsPublisher::setCounter(const char* counterName, double value) {
+    if (!segment) return;
+    for (int i = 0; i < counterCount; i++) {
+        if (std::strcmp(counters[i].name, counterName) == 0) {
+            counters[i].value = value;
+            return;
+        }
+    }
+    if (counterCount == METRICS_MAX_COUNTERS) return;
+    MetricsCounter& counter = counters[counterCount++];
+    std::strncpy(counter.name, counterName, METRICS_NAME_SIZE - 1);
+    counter.name[METRICS_NAME_SIZE - 1] = '\0';
+    counter.value = value;
+}
+
+void MetricsPublisher::endFrame() {
+    if (!segment) return;
+
+    Uint64 now = SDL_GetPerformanceCounter();
+    double msPerTick = 1000.0 / SDL_GetPerformanceFrequency();
+    if (lastFrameEnd != 0 && frameMs.size() < MAX_FRAME_SAMPLES) {
+        frameMs.push_back((now - lastFrameEnd) * msPerTick);
+    }
+    lastFrameEnd = now;
+    frames++;
+    intervalFrames++;
+    intervalAllocs += AllocTracker::getLastFrameAllocs();
+    intervalBytes += AllocTracker::getLastFrameBytes();
+
+    if ((now - intervalStart) * msPerTick >= 1000.0) {
+        publish(now);
+    }
+}
+
+void MetricsPublisher::publish(Uint64 now) {
+    double frequency = static_cast<double>(SDL_GetPerformanceFrequency());
+    double seconds = (now - intervalStart) / frequency;
+
+    // Everything is worked out first so the locked part is a copy
+    MetricsSnapshot snapshot;
+    std::memset(&snapshot, 0, sizeof(snapshot));
+    snapshot.publishCount = ++publishCount;
+    snapshot.frames = frames;
+    snapshot.uptimeSeconds = (now - startTicks) / frequency;
+    snapshot.intervalSeconds = seconds;
+    snapshot.fps = intervalFrames / seconds;
+
+    sorted.assign(frameMs.begin(), frameMs.end());
+    std::sort(sorted.begin(), sorted.end());
+    if (!sorted.empty()) {
+        double total = 0.0;
+        for (double ms : sorted) total += ms;
+        auto percentile = [&](double p) {
+            size_t index = static_cast<size_t>(p / 100.0 * (sorted.size() - 1) + 0.5);
+            return sorted[index];
+        };
+        snapshot.frameMsMean = total / sorted.size();
+        snapshot.frameMsP50 = percentile(50);
+        snapshot.frameMsP95 = percentile(95);
+        snapshot.frameMsP99 = percentile(99);
+        snapshot.frameMsMax = sorted.back();
+    }
+    snapshot.allocsPerSecond = intervalAllocs / seconds;
+    snapshot.allocBytesPerSecond = intervalBytes / seconds;
+#ifndef _WIN32
+    snapshot.pid = static_cast<int32_t>(getpid());
+#endif
+    snapshot.counterCount = counterCount;
+    std::copy(counters, counters + counterCount, snapshot.counters);
+
+    // Seqlock write: odd while the snapshot is being replaced
+    uint32_t sequence = segment->sequence.load(std::memory_order_relaxed);
+    segment->sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(&segment->snapshot, &snapshot, sizeof(snapshot));
+    segment->sequence.store(sequence + 2, std::memory_order_release);
+
+    intervalStart = now;
+    frameMs.clear();
+    intervalFrames = 0;
+    intervalAllocs = 0;
+    intervalBytes = 0;
+}
@@ -0,0 +1,60 @@
+#ifndef METRICS_PUBLISHER_H
+#define METRICS_PUBLISHER_H
+
+#include <SDL2/SDL.h>
+#include <string>
+#include <vector>
+#include "MetricsFormat.h"
+
+// Live metrics for soak tests: once a second the main loop's frame times, FPS,
+// allocation rate and the counts set through setCounter() are written into a
+// shared-memory segment (layout in MetricsFormat.h) that tools/metricsreader
+// or any dashboard can map and poll. Local to the machine by construction, and
+// a reader can never stall the game: the seqlock makes it retry instead.
+//
+// POSIX shared memory only; on Windows start() logs and does nothing.
+// Main thread only.
+class MetricsPublisher {
+private:
+    static const int MAX_FRAME_SAMPLES = 4096;  // per second; beyond that frames aren't sampled
+
+    MetricsSegment* segment;
+    std::string name;
+
+    std::vector<double> frameMs;     // this interval
+    std::vector<double> sorted;      // scratch for percentiles
+    MetricsCounter counters[METRICS_MAX_COUNTERS];
+    int counterCount;
+
+    Uint64 startTicks;
+    Uint64 intervalStart;
+    Uint64 lastFrameEnd;
+    uint64_t frames;
+    uint64_t intervalFrames;
+    uint64_t intervalAllocs;
+    uint64_t intervalBytes;
+    uint64_t publishCount;
+
+    static MetricsPublisher* instance;
+
+    MetricsPublisher();  // Private constructor for singleton
+
+    void publish(Uint64 now);
+
+public:
+    static MetricsPublisher* getInstance();
+
+    // Create (or take over) the segment; shmName starts with '/'
+    bool start(const std::string& shmName = METRICS_DEFAULT_NAME);
+    // Unmap and remove the segment
+    void stop();
+    bool isActive() const { return segment != nullptr; }
+
+    // Value of a named count, published with the next snapshot
+    void setCounter(const char* counterName, double value);
+
+    // Once per presented frame, after AllocTracker::endFrame()
+    void endFrame();
+};
+
+#endif // METRICS_PUBLISHER_H
@@ -0,0 +1,65 @@
+#include "Profiler.h"
+#include "Logger.h"
+#include <cstring>
+
+Profiler* Profiler::instance = nullptr;
+
+Profiler* Profiler::getInstance() {
+    if (instance == nullptr) {
+        instance = new Profiler();
+    }
+    return instance;
+}
+
+Profiler::Profiler() : enabled(false), timing(false), msPerTick(1000.0 / SDL_GetPerformanceFrequency()) {
+    scopes.reserve(MAX_SCOPES);  // Never reallocates under a reader on another thread
+    for (std::atomic<Uint64>& ticks : frameTicks) {
+        ticks.store(0, std::memory_order_relaxed);
+    }
+}
+
+int Profiler::registerScope(const char* name) {
+    std::lock_guard<std::mutex> lock(registerMutex);
+    for (int i = 0; i < static_cast<int>(scopes.size()); i++) {
+        if (std::strcmp(scopes[i].name, name) == 0) return i;
+    }
+    if (static_cast<int>(scopes.size()) == MAX_SCOPES) {
+        LOG_WARN("Profiler: no slot left for scope '%s', timing it under '%s'", name, scopes[MAX_SCOPES - 1].name);
+        return MAX_SCOPES - 1;
+    }
+    scopes.push_back({name, BenchSeries(name)});
+    return static_cast<int>(scopes.size()) - 1;
+}
+
+void Profiler::endFrame() {
+    std::lock_guard<std::mutex> lock(registerMutex);
+    for (int i = 0; i < static_cast<int>(scopes.size()); i++) {
+        Uint64 ticks = frameTicks[i].exchange(0, std::memory_order_relaxed);
+        if (enabled) {
+            scopes[i].series.add(ticks * msPerTick);
+        }
+    }
+}
+
+void Profiler::reset() {
+    std::lock_guard<std::mutex> lock(registerMutex);
+    for (int i = 0; i < static_cast<int>(scopes.size()); i++) {
+        scopes[i].series.clear();
+        frameTicks[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+int Profiler::getScopeCount() const {
+    std::lock_guard<std::mutex> lock(registerMutex);
+    return static_cast<int>(scopes.size());
+}
+
+const char* Profiler::getName(int slot) const {
+    std::lock_guard<std::mutex> lock(registerMutex);
+    return scopes[slot].name;
+}
+
+const BenchSeries& Profiler::getSeries(int slot) const {
+    std::lock_guard<std::mutex> lock(registerMutex);
+    return scopes[slot].series;
+}
@@ -0,0 +1,108 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <SDL2/SDL.h>
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include "bench/BenchReport.h"
+#include "AllocTracker.h"
+#include "Tracer.h"
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+// Time the rest of the enclosing block under name, charge its heap
+// allocations to the same name (AllocTracker.h) and put it on the trace
+// timeline while a capture runs (Tracer.h). The slot is looked up once per
+// call site; after that a scope costs two counter reads, or a couple of
+// branches while the profiler and tracer are off.
+#define PROFILE_SCOPE(name) \
+    static const int PROFILE_CONCAT(profileSlot_, __LINE__) = Profiler::getInstance()->registerScope(name); \
+    ProfileScope PROFILE_CONCAT(profileScope_, __LINE__)(PROFILE_CONCAT(profileSlot_, __LINE__)); \
+    TRACE_SCOPE(name); \
+    ALLOC_SCOPE(name)
+
+// Per-frame time spent in each named section of the game loop. Scopes add into
+// their slot during a frame and endFrame() turns the totals into one sample per
+// scope, so a section that runs several times a frame (or not at all) still
+// gives one number per frame. The main loop closes every frame; endFrame() and
+// reset() are main thread only.
+//
+// Scopes time while either the profiler is enabled (per-frame series are kept)
+// or timing is switched on for a reader of the current frame such as the
+// FlightRecorder, which only wants getFrameMs() before the frame closes.
+// Scopes may also register and time on other threads: gameplay's simulation
+// thread adds into the same frame totals, and batch runs register from their
+// workers with the profiler off. Anything that walks the scope list takes the
+// registration lock, since a new call site can register at any time.
+class Profiler {
+public:
+    static const int MAX_SCOPES = 128;  // past this, new names share the last slot with a warning
+
+private:
+    struct Scope {
+        const char* name;
+        BenchSeries series; // ms per frame
+    };
+
+    std::vector<Scope> scopes;
+    std::atomic<Uint64> frameTicks[MAX_SCOPES];  // accumulated this frame, per slot
+    mutable std::mutex registerMutex;  // Call sites can register from any thread
+    bool enabled;
+    bool timing;
+    double msPerTick;
+
+    static Profiler* instance;
+
+    Profiler(); // Private constructor for singleton
+
+public:
+    static Profiler* getInstance();
+
+    // Slot for name, shared by every call site using the same name
+    int registerScope(const char* name);
+
+    void setEnabled(bool on) { enabled = on; }
+    bool isEnabled() const { return enabled; }
+
+    // Time scopes without keeping series
+    void setTiming(bool on) { timing = on; }
+    bool isTiming() const { return enabled || timing; }
+
+    void add(int slot, Uint64 ticks) { frameTicks[slot].fetch_add(ticks, std::memory_order_relaxed); }
+
+    // Close the frame: one sample per scope if enabled, then start the next frame at zero
+    void endFrame();
+
+    // Drop every sample so far, e.g. after a warmup
+    void reset();
+
+    int getScopeCount() const;
+    const char* getName(int slot) const;
+    const BenchSeries& getSeries(int slot) const;
+
+    // Time spent in slot so far this frame
+    double getFrameMs(int slot) const { return frameTicks[slot].load(std::memory_order_relaxed) * msPerTick; }
+};
+
+class ProfileScope {
+private:
+    int slot;
+    Uint64 start;
+
+public:
+    explicit ProfileScope(int scopeSlot)
+        : slot(scopeSlot), start(Profiler::getInstance()->isTiming() ? SDL_GetPerformanceCounter() : 0) {}
+
+    ~ProfileScope() {
+        if (start != 0) {
+            Profiler::getInstance()->add(slot, SDL_GetPerformanceCounter() - start);
+        }
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+};
+
+#endif // PROFILER_H
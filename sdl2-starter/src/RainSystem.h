@@ -1,75 +1,73 @@
 #pragma once
 #include <SDL2/SDL.h>
-#include <deque>
 #include <random>
 #include <ctime>
-
-struct RainDrop {
-    float x, y;           // Position
-    float velocityY;      // Vertical velocity
-    float velocityX;      // Horizontal velocity
-    float lifetime;       // How long the drop exists
-    Uint8 alpha;         // Transparency
-};
+#include <cstdint>
+#include "particles/ParticleSystem.h"
 
 class RainSystem {
 private:
-    std::deque<RainDrop> raindrops;
+    ParticlePool raindrops;
+    ParticleEmitter emitter;
+    QuadBatch batch;
     std::mt19937 rng;
     int screenWidth;
     int screenHeight;
     static const int MAX_DROPS = 500;
+    static constexpr float FALL_SPEED = 500.0f;  // pixels per second
+
+    ParticleParams makeDrop(float x) const {
+        ParticleParams drop;
+        drop.x = x;
+        drop.y = -5.0f;              // Start above screen
+        drop.velocityY = FALL_SPEED; // Falling speed
+        drop.velocityX = -150.f;     // Make the rain fall slightly slanted
+        drop.lifetime = 2.0f;        // Live for 2 seconds
+        drop.alpha = 180;            // Slightly transparent
+        return drop;
+    }
     
 public:
-    RainSystem(int width, int height) : screenWidth(width), screenHeight(height) {
-        rng.seed(std::time(nullptr));
-    }
+    // drops > 0 keeps about that many on screen at once (scenario runs) and starts
+    // with the screen already full; 0 is the usual drizzle
+    RainSystem(int width, int height, int drops = 0, uint32_t seed = 0)
+        : raindrops(drops > 0 ? drops + drops / 4 : MAX_DROPS, ParticleShape::STREAK),
+          emitter(drops > 0 ? drops * FALL_SPEED / (height + 5.0f) : 120.0f),  // 2 drops per frame at 60 FPS
+          batch(drops > 0 ? drops + drops / 4 : MAX_DROPS), screenWidth(width), screenHeight(height) {
+        rng.seed(seed != 0 ? seed : static_cast<uint32_t>(std::time(nullptr)));
 
-    void update(float deltaTime) {
-        // Add new raindrops
+        // Light blue streaks that fall slightly slanted
+        raindrops.setColor(173, 216, 230);
+        raindrops.setStreakScale(1.0f / 50.0f);  // About 10 pixels long
+        raindrops.setKillY(static_cast<float>(screenHeight));
+
+        // One screen's worth already falling, as if it had been raining a while
         std::uniform_real_distribution<float> xDist(0, static_cast<float>(screenWidth));
-        
-        // Add 2 new drops per frame if we haven't reached max
-        for (int i = 0; i < 2 && raindrops.size() < MAX_DROPS; i++) {
-            RainDrop drop;
-            drop.x = xDist(rng);
-            drop.y = -5.0f;  // Start above screen
-            drop.velocityY = 500.0f;  // Falling speed
-            drop.velocityX = -150.f; // Make the rain fall slightly slanted
-            drop.lifetime = 2.0f;     // Live for 2 seconds
-            drop.alpha = 180;         // Slightly transparent
-            raindrops.push_back(drop);
+        std::uniform_real_distribution<float> yDist(-5.0f, static_cast<float>(screenHeight));
+        for (int i = 0; i < drops && !raindrops.full(); i++) {
+            ParticleParams drop = makeDrop(xDist(rng));
+            drop.y = yDist(rng);
+            raindrops.emit(drop);
         }
+    }
 
-        // Update existing drops
-        for (auto it = raindrops.begin(); it != raindrops.end();) {
-            it->y += it->velocityY * deltaTime;
-            it->x += it->velocityX * deltaTime;
-            it->lifetime -= deltaTime;
-            it->alpha = static_cast<Uint8>((it->lifetime / 2.0f) * 180);
+    void update(float deltaTime) {
+        // Add new raindrops; the pool drops any that don't fit under MAX_DROPS
+        std::uniform_real_distribution<float> xDist(0, static_cast<float>(screenWidth));
 
-            // Remove drops that are off screen or expired
-            if (it->lifetime <= 0 || it->y > screenHeight) {
-                it = raindrops.erase(it);
-            } else {
-                ++it;
-            }
+        int spawns = emitter.due(deltaTime);
+        for (int i = 0; i < spawns && !raindrops.full(); i++) {
+            raindrops.emit(makeDrop(xDist(rng)));
         }
+
+        // Move, fade and remove drops that are off screen or expired
+        raindrops.update(deltaTime);
     }
 
     void render(SDL_Renderer* renderer) {
-        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-        
-        for (const auto& drop : raindrops) {
-            // Set color to light blue with alpha
-            SDL_SetRenderDrawColor(renderer, 173, 216, 230, drop.alpha);
-            
-            // Draw raindrop as a small line
-            SDL_RenderDrawLine(renderer,
-                static_cast<int>(drop.x),
-                static_cast<int>(drop.y),
-                static_cast<int>(drop.x + drop.velocityX / 60),
-                static_cast<int>(drop.y + 10));  // 10 pixels long
-        }
+        raindrops.render(renderer, batch);
     }
+
+    int size() const { return raindrops.size(); }
+    size_t memoryBytes() const { return raindrops.memoryBytes() + batch.memoryBytes(); }
 };
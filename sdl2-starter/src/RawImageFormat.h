@@ -0,0 +1,30 @@
+#ifndef RAW_IMAGE_FORMAT_H
+#define RAW_IMAGE_FORMAT_H
+
+#include <cstdint>
+
+// Pre-decoded image format written by tools/torgba.cpp. Loading one is a header
+// check and a copy (or no copy at all out of the mapped assets.pack), instead
+// of inflating a PNG. Layout, little-endian:
+//
+//   RawImageHeader
+//   width * height * 4 bytes of pixels, rows top to bottom, no padding,
+//   each pixel R, G, B, A in that byte order (SDL_PIXELFORMAT_RGBA32)
+//
+// The file for "assets/wasp.png" is "assets/wasp.rgba"; ImageLoader picks it
+// over the PNG when it exists.
+
+static const char RAW_IMAGE_MAGIC[4] = {'F', 'G', 'R', 'A'};
+static const uint32_t RAW_IMAGE_VERSION = 1;
+static const uint32_t RAW_IMAGE_MAX_SIZE = 16384;  // per side, guards against bad headers
+
+struct RawImageHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t width;
+    uint32_t height;
+};
+
+static_assert(sizeof(RawImageHeader) == 16, "RawImageHeader layout changed");
+
+#endif // RAW_IMAGE_FORMAT_H
@@ -0,0 +1,55 @@
+#include "SimulationThread.h"
+#include "World.h"
+#include "Tracer.h"
+
+SimulationThread::SimulationThread(World& simulated)
+    : world(simulated), deltaTime(0.0f), ticking(false), stopping(false) {
+    worker = std::thread(&SimulationThread::workerLoop, this);
+}
+
+SimulationThread::~SimulationThread() {
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        tickFinished.wait(lock, [this] { return !ticking; });
+        stopping = true;
+    }
+    tickStarted.notify_one();
+    worker.join();
+}
+
+void SimulationThread::workerLoop() {
+    Tracer::getInstance()->setThreadName("simulation");
+
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        tickStarted.wait(lock, [this] { return stopping || ticking; });
+        if (stopping) break;
+
+        // The tick itself, with the lock released; nothing else touches the world now
+        float dt = deltaTime;
+        lock.unlock();
+        {
+            TRACE_SCOPE("simulate");
+            world.update(dt);
+        }
+        lock.lock();
+
+        ticking = false;
+        tickFinished.notify_one();
+    }
+    Tracer::getInstance()->releaseThreadName();  // The next match's thread takes over the track
+}
+
+void SimulationThread::start(float dt) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        deltaTime = dt;
+        ticking = true;
+    }
+    tickStarted.notify_one();
+}
+
+void SimulationThread::wait() {
+    std::unique_lock<std::mutex> lock(mutex);
+    tickFinished.wait(lock, [this] { return !ticking; });
+}
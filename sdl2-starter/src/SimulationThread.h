@@ -0,0 +1,44 @@
+#ifndef SIMULATION_THREAD_H
+#define SIMULATION_THREAD_H
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+class World;
+
+// Steps a World on its own thread, so the next tick is simulated while the main
+// thread draws the last one from a WorldSnapshot. start() hands one tick over and
+// returns at once; wait() blocks until it's done. Between wait() and the next
+// start() the world belongs to the caller again: that's when input goes in and
+// the snapshot is taken. One tick in flight at a time; every method is called
+// from the main thread. No SDL calls are made on the simulation thread.
+class SimulationThread {
+private:
+    World& world;
+    std::thread worker;
+    float deltaTime;
+    bool ticking;    // a tick was handed over and hasn't finished
+    bool stopping;
+
+    std::mutex mutex;
+    std::condition_variable tickStarted;
+    std::condition_variable tickFinished;
+
+    void workerLoop();
+
+public:
+    explicit SimulationThread(World& simulated);
+    ~SimulationThread();  // Finishes the tick in flight, then stops the thread
+
+    SimulationThread(const SimulationThread&) = delete;
+    SimulationThread& operator=(const SimulationThread&) = delete;
+
+    // Run world.update(dt) on the simulation thread
+    void start(float dt);
+
+    // Block until the tick from start() is done; returns at once if there's none
+    void wait();
+};
+
+#endif // SIMULATION_THREAD_H
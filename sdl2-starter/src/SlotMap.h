@@ -0,0 +1,133 @@
+#ifndef SLOT_MAP_H
+#define SLOT_MAP_H
+
+#include <vector>
+#include <cstdint>
+
+// Stable reference to an element in a SlotMap. A handle goes stale when its
+// element is removed: the slot's generation moves on and get() returns nullptr.
+struct SlotHandle {
+    uint32_t index = UINT32_MAX;
+    uint32_t generation = 0;
+
+    bool valid() const { return index != UINT32_MAX; }
+};
+
+// Fixed-capacity slot map. Elements live packed at the front of one contiguous
+// array, so iterating is a linear scan; a slot table plus free list maps stable
+// handles to those packed positions. Removal swaps the last element into the hole.
+// All storage is allocated in the constructor.
+template <typename T>
+class SlotMap {
+private:
+    struct Slot {
+        uint32_t denseIndex;
+        uint32_t generation;
+    };
+
+    std::vector<T> dense;                 // packed elements, first `count` are live
+    std::vector<uint32_t> denseToSlot;    // which slot owns each packed element
+    std::vector<Slot> slots;
+    std::vector<uint32_t> freeSlots;      // stack of unused slot indices
+    int count;
+
+    // Swap-remove the packed element at denseIndex and retire its slot
+    void eraseDense(uint32_t denseIndex) {
+        uint32_t slotIndex = denseToSlot[denseIndex];
+        uint32_t last = static_cast<uint32_t>(--count);
+
+        if (denseIndex != last) {
+            dense[denseIndex] = dense[last];
+            denseToSlot[denseIndex] = denseToSlot[last];
+            slots[denseToSlot[denseIndex]].denseIndex = denseIndex;
+        }
+
+        slots[slotIndex].generation++;  // Invalidate outstanding handles
+        freeSlots.push_back(slotIndex);  // Never grows past capacity
+    }
+
+public:
+    explicit SlotMap(int capacity) : count(0) {
+        dense.resize(capacity);
+        denseToSlot.resize(capacity);
+        slots.resize(capacity);
+        freeSlots.reserve(capacity);
+
+        // Hand out low slots first
+        for (int i = capacity - 1; i >= 0; i--) {
+            slots[i] = {0, 0};
+            freeSlots.push_back(static_cast<uint32_t>(i));
+        }
+    }
+
+    // Returns an invalid handle when the map is full
+    SlotHandle insert(const T& value) {
+        if (freeSlots.empty()) return SlotHandle();
+
+        uint32_t slotIndex = freeSlots.back();
+        freeSlots.pop_back();
+
+        uint32_t denseIndex = static_cast<uint32_t>(count++);
+        dense[denseIndex] = value;
+        denseToSlot[denseIndex] = slotIndex;
+        slots[slotIndex].denseIndex = denseIndex;
+
+        SlotHandle handle;
+        handle.index = slotIndex;
+        handle.generation = slots[slotIndex].generation;
+        return handle;
+    }
+
+    T* get(SlotHandle handle) {
+        if (!contains(handle)) return nullptr;
+        return &dense[slots[handle.index].denseIndex];
+    }
+
+    const T* get(SlotHandle handle) const {
+        if (!contains(handle)) return nullptr;
+        return &dense[slots[handle.index].denseIndex];
+    }
+
+    bool contains(SlotHandle handle) const {
+        return handle.index < slots.size() && slots[handle.index].generation == handle.generation
+            && slots[handle.index].denseIndex < static_cast<uint32_t>(count)
+            && denseToSlot[slots[handle.index].denseIndex] == handle.index;
+    }
+
+    bool remove(SlotHandle handle) {
+        if (!contains(handle)) return false;
+        eraseDense(slots[handle.index].denseIndex);
+        return true;
+    }
+
+    // Remove every element matching pred in one pass over the packed array
+    template <typename Pred>
+    void removeIf(Pred pred) {
+        for (uint32_t i = 0; i < static_cast<uint32_t>(count); ) {
+            if (pred(dense[i])) {
+                eraseDense(i);  // Re-check i, it now holds the moved element
+            } else {
+                ++i;
+            }
+        }
+    }
+
+    void clear() {
+        while (count > 0) {
+            eraseDense(static_cast<uint32_t>(count - 1));
+        }
+    }
+
+    // Iteration covers only the live, packed elements
+    T* begin() { return dense.data(); }
+    T* end() { return dense.data() + count; }
+    const T* begin() const { return dense.data(); }
+    const T* end() const { return dense.data() + count; }
+
+    int size() const { return count; }
+    int capacity() const { return static_cast<int>(dense.size()); }
+    bool empty() const { return count == 0; }
+    bool full() const { return freeSlots.empty(); }
+};
+
+#endif // SLOT_MAP_H
@@ -0,0 +1,125 @@
+#include "SpawnDirector.h"
+#include <algorithm>
+#include <cmath>
+
+SpawnDirector::SpawnDirector(uint32_t seed, int width, int height)
+    : screenWidth(width), screenHeight(height), rng(seed), configs(), waveTimers(),
+      terrainVersion(0), hasTerrain(false) {
+    // Defaults match the old cadence at 60 FPS: 3 wasps every 300 frames, a turtle every 500
+    configure(SpawnType::WASP, {5.0f, 3, 64, 16 * 3, 16 * 3});
+    configure(SpawnType::TURTLE, {500.0f / 60.0f, 1, 16, 32 * 3, 19 * 3});
+    reset();
+}
+
+void SpawnDirector::configure(SpawnType type, const WaveConfig& config) {
+    configs[index(type)] = config;
+
+    // A wave can never ask for more than the budget, so this is the most one tick queues
+    int most = 0;
+    for (const WaveConfig& c : configs) {
+        most += std::min(c.perWave, c.budget);
+    }
+    requests.reserve(most);
+}
+
+void SpawnDirector::reset() {
+    for (float& timer : waveTimers) {
+        timer = 0.0f;
+    }
+    requests.clear();
+}
+
+void SpawnDirector::setTerrain(const TerrainGrid& terrain) {
+    if (hasTerrain && terrain.getVersion() == terrainVersion) return;
+
+    // Only when the map itself changes: O(cells) here keeps waves O(1)
+    landCells.clear();
+    landCells.reserve(terrain.getWidth() * terrain.getHeight());
+    int cellSize = terrain.getCellSize();
+    for (int y = 0; y < terrain.getHeight(); y++) {
+        for (int x = 0; x < terrain.getWidth(); x++) {
+            if (!terrain.isWater(x, y)) {
+                landCells.push_back({x * cellSize + cellSize / 2, y * cellSize + cellSize / 2});
+            }
+        }
+    }
+
+    terrainVersion = terrain.getVersion();
+    hasTerrain = true;
+}
+
+bool SpawnDirector::farFromFrog(int x, int y, const WaveConfig& config, float frogX, float frogY) const {
+    float dx = x + config.width / 2.0f - frogX;
+    float dy = y + config.height / 2.0f - frogY;
+    return dx * dx + dy * dy >= static_cast<float>(MIN_FROG_DISTANCE * MIN_FROG_DISTANCE);
+}
+
+SDL_Point SpawnDirector::pickEdgePoint(const WaveConfig& config, float frogX, float frogY) {
+    std::uniform_int_distribution<int> sideDist(0, 3);
+    std::uniform_int_distribution<int> xDist(0, screenWidth - config.width);
+    std::uniform_int_distribution<int> yDist(0, screenHeight - config.height);
+
+    SDL_Point point = {0, 0};
+    for (int attempt = 0; attempt < PICK_ATTEMPTS; attempt++) {
+        switch (sideDist(rng)) {
+            case 0:  // top
+                point = {xDist(rng), 0};
+                break;
+            case 1:  // right
+                point = {screenWidth - config.width, yDist(rng)};
+                break;
+            case 2:  // bottom
+                point = {xDist(rng), screenHeight - config.height};
+                break;
+            default:  // left
+                point = {0, yDist(rng)};
+                break;
+        }
+        if (farFromFrog(point.x, point.y, config, frogX, frogY)) break;
+    }
+    return point;
+}
+
+SDL_Point SpawnDirector::pickLandPoint(const WaveConfig& config, float frogX, float frogY) {
+    if (landCells.empty()) {
+        return pickEdgePoint(config, frogX, frogY);  // No map yet, or all water
+    }
+
+    std::uniform_int_distribution<size_t> cellDist(0, landCells.size() - 1);
+    SDL_Point point = {0, 0};
+    for (int attempt = 0; attempt < PICK_ATTEMPTS; attempt++) {
+        const SDL_Point& cell = landCells[cellDist(rng)];
+
+        // Center the enemy on the cell, kept fully inside the level
+        point.x = std::min(std::max(cell.x - config.width / 2, 0), screenWidth - config.width);
+        point.y = std::min(std::max(cell.y - config.height / 2, 0), screenHeight - config.height);
+        if (farFromFrog(point.x, point.y, config, frogX, frogY)) break;
+    }
+    return point;
+}
+
+const std::vector<SpawnRequest>& SpawnDirector::update(float deltaTime, float frogX, float frogY,
+                                                      int liveWasps, int liveTurtles) {
+    requests.clear();
+    int alive[NUM_TYPES] = {liveWasps, liveTurtles};
+    const SpawnType types[NUM_TYPES] = {SpawnType::WASP, SpawnType::TURTLE};
+
+    for (int t = 0; t < NUM_TYPES; t++) {
+        const WaveConfig& config = configs[t];
+        if (config.interval <= 0.0f) continue;
+
+        waveTimers[t] += deltaTime;
+        if (waveTimers[t] < config.interval) continue;
+
+        // One wave per tick at most, even after a long hitch
+        waveTimers[t] = std::fmod(waveTimers[t], config.interval);
+
+        int count = std::min(config.perWave, config.budget - alive[t]);
+        for (int i = 0; i < count; i++) {
+            SDL_Point p = types[t] == SpawnType::WASP ? pickEdgePoint(config, frogX, frogY)
+                                                      : pickLandPoint(config, frogX, frogY);
+            requests.push_back({types[t], p.x, p.y});
+        }
+    }
+    return requests;
+}
@@ -0,0 +1,73 @@
+#ifndef SPAWN_DIRECTOR_H
+#define SPAWN_DIRECTOR_H
+
+#include "terrain/TerrainGrid.h"
+#include <vector>
+#include <random>
+#include <cstdint>
+
+enum class SpawnType {
+    WASP,
+    TURTLE
+};
+
+// One enemy the director wants placed this tick; (x, y) is the top-left of its rect
+struct SpawnRequest {
+    SpawnType type;
+    int x, y;
+};
+
+// Wave schedule and population cap for one enemy type
+struct WaveConfig {
+    float interval;     // seconds between waves
+    int perWave;        // enemies per wave
+    int budget;         // never more than this many alive at once
+    int width, height;  // size of the enemy's rect, to keep spawns inside the level
+};
+
+// Decides when and where enemies appear. Waves run on elapsed time rather than
+// frame count, each type is capped by its budget, and spawn points come from
+// lists built once per map (screen edges for wasps, dry land for turtles), so a
+// wave costs a few random picks and never allocates.
+class SpawnDirector {
+public:
+    static const int MIN_FROG_DISTANCE = 250;  // pixels; spawns never land closer than this
+
+    SpawnDirector(uint32_t seed, int screenWidth, int screenHeight);
+
+    void configure(SpawnType type, const WaveConfig& config);
+    const WaveConfig& getConfig(SpawnType type) const { return configs[index(type)]; }
+
+    // Start the wave clocks over, e.g. for a new run
+    void reset();
+
+    // Rebuild the turtle spawn cells if the map changed since the last call
+    void setTerrain(const TerrainGrid& terrain);
+
+    // Advance the wave clocks and return the spawns due this tick. The returned
+    // list is reused; it is valid until the next update().
+    const std::vector<SpawnRequest>& update(float deltaTime, float frogX, float frogY,
+                                            int liveWasps, int liveTurtles);
+
+private:
+    static const int NUM_TYPES = 2;
+    static const int PICK_ATTEMPTS = 8;
+
+    int screenWidth, screenHeight;
+    std::mt19937 rng;
+    WaveConfig configs[NUM_TYPES];
+    float waveTimers[NUM_TYPES];
+
+    std::vector<SDL_Point> landCells;  // centers of cells turtles may spawn on
+    uint32_t terrainVersion;
+    bool hasTerrain;
+
+    std::vector<SpawnRequest> requests;
+
+    static int index(SpawnType type) { return type == SpawnType::WASP ? 0 : 1; }
+    bool farFromFrog(int x, int y, const WaveConfig& config, float frogX, float frogY) const;
+    SDL_Point pickEdgePoint(const WaveConfig& config, float frogX, float frogY);
+    SDL_Point pickLandPoint(const WaveConfig& config, float frogX, float frogY);
+};
+
+#endif // SPAWN_DIRECTOR_H
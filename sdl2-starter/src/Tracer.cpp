@@ -0,0 +1,156 @@
+#include "Tracer.h"
+#include "Logger.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
+static const size_t EVENTS_PER_FRAME = 512;  // buffer size per captured frame
+
+std::atomic<bool> Tracer::recording(false);
+Tracer* Tracer::instance = nullptr;
+
+static thread_local int threadSlot = -1;  // the calling thread's track, once it has one
+
+Tracer* Tracer::getInstance() {
+    if (instance == nullptr) {
+        instance = new Tracer();
+    }
+    return instance;
+}
+
+Tracer::Tracer()
+    : capacity(0), used(0), dropped(0), writers(0), framesLeft(0), captureStart(0), threadCount(0) {
+    std::fill(threadNames, threadNames + MAX_THREADS, nullptr);
+    std::fill(released, released + MAX_THREADS, false);
+}
+
+int Tracer::threadIndex() {
+    if (threadSlot < 0) {
+        threadSlot = threadCount.fetch_add(1);
+    }
+    return threadSlot;
+}
+
+void Tracer::setThreadName(const char* name) {
+    std::lock_guard<std::mutex> lock(nameMutex);
+    int named = std::min(threadCount.load(), static_cast<int>(MAX_THREADS));
+    for (int i = 0; i < named; i++) {
+        if (released[i] && std::strcmp(threadNames[i], name) == 0) {
+            released[i] = false;
+            threadSlot = i;
+            return;
+        }
+    }
+    int index = threadIndex();
+    if (index < MAX_THREADS) {
+        threadNames[index] = name;
+    }
+}
+
+void Tracer::releaseThreadName() {
+    std::lock_guard<std::mutex> lock(nameMutex);
+    if (threadSlot >= 0 && threadSlot < MAX_THREADS && threadNames[threadSlot]) {
+        released[threadSlot] = true;
+    }
+    threadSlot = -1;
+}
+
+void Tracer::start(int frames, const std::string& outputPath) {
+    if (isRecording() || frames <= 0) return;
+
+    size_t needed = static_cast<size_t>(frames) * EVENTS_PER_FRAME;
+    if (needed > capacity) {
+        events.reset(new Event[needed]);
+        capacity = needed;
+    }
+    used = 0;
+    dropped = 0;
+    framesLeft = frames;
+    path = outputPath;
+    captureStart = SDL_GetPerformanceCounter();
+    recording.store(true, std::memory_order_release);
+    LOG_INFO("Tracing %d frames to %s", frames, path.c_str());
+}
+
+void Tracer::push(const Event& event) {
+    // Sequentially consistent on purpose: pairs with endFrame's store and wait
+    writers.fetch_add(1);
+    if (recording.load()) {
+        size_t slot = used.fetch_add(1, std::memory_order_relaxed);
+        if (slot < capacity) {
+            events[slot] = event;
+        } else {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    writers.fetch_sub(1);
+}
+
+void Tracer::complete(const char* name, Uint64 start, Uint64 end) {
+    push({name, start, end, 0.0, threadIndex(), 'X'});
+}
+
+void Tracer::counter(const char* name, double value) {
+    if (!isRecording()) return;
+    Uint64 now = SDL_GetPerformanceCounter();
+    push({name, now, now, value, threadIndex(), 'C'});
+}
+
+void Tracer::endFrame() {
+    if (!isRecording() || --framesLeft > 0) return;
+
+    // Stop taking events, then wait out anyone halfway through writing one
+    recording.store(false);
+    while (writers.load() != 0) {
+        std::this_thread::yield();
+    }
+
+    if (write()) {
+        LOG_INFO("Wrote trace %s (%zu events, %zu dropped)", path.c_str(),
+                 std::min(used.load(), capacity), dropped.load());
+    } else {
+        LOG_ERROR("Couldn't write trace %s", path.c_str());
+    }
+}
+
+bool Tracer::write() {
+    FILE* file = fopen(path.c_str(), "w");
+    if (!file) return false;
+
+    double microsPerTick = 1000000.0 / SDL_GetPerformanceFrequency();
+    auto micros = [&](Uint64 ticks) {
+        return (static_cast<double>(ticks) - static_cast<double>(captureStart)) * microsPerTick;
+    };
+
+    fprintf(file, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n");
+    fprintf(file, "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": 1, \"args\": {\"name\": \"FrogGun\"}}");
+    {
+        std::lock_guard<std::mutex> lock(nameMutex);
+        int threads = std::min(threadCount.load(), static_cast<int>(MAX_THREADS));
+        for (int i = 0; i < threads; i++) {
+            if (!threadNames[i]) continue;
+            fprintf(file, ",\n{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": %d, "
+                          "\"args\": {\"name\": \"%s\"}}", i, threadNames[i]);
+        }
+    }
+
+    size_t count = std::min(used.load(), capacity);
+    for (size_t i = 0; i < count; i++) {
+        const Event& event = events[i];
+        if (event.phase == 'X') {
+            fprintf(file, ",\n{\"name\": \"%s\", \"ph\": \"X\", \"pid\": 1, \"tid\": %d, "
+                          "\"ts\": %.3f, \"dur\": %.3f}", event.name, event.thread,
+                    micros(event.start), (event.end - event.start) * microsPerTick);
+        } else {
+            fprintf(file, ",\n{\"name\": \"%s\", \"ph\": \"C\", \"pid\": 1, \"tid\": %d, "
+                          "\"ts\": %.3f, \"args\": {\"value\": %g}}", event.name, event.thread,
+                    micros(event.start), event.value);
+        }
+    }
+    fprintf(file, "\n]}\n");
+
+    bool ok = ferror(file) == 0;
+    fclose(file);
+    return ok;
+}
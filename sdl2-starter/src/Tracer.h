@@ -0,0 +1,106 @@
+#ifndef TRACER_H
+#define TRACER_H
+
+#include <SDL2/SDL.h>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+
+// Record the rest of the enclosing block as one slice on this thread's track.
+// name must outlive the capture (a string literal). Costs one relaxed load
+// while no capture is running.
+#define TRACE_SCOPE(name) TraceScope TRACE_CONCAT(traceScope_, __LINE__)(name)
+
+// Frame timelines in Chrome's trace event format, for chrome://tracing or
+// ui.perfetto.dev. start() arms a capture of the next N frames: every
+// TRACE_SCOPE (and so every PROFILE_SCOPE) on any thread becomes a complete
+// ("X") event, counter() adds a value to a counter track, and the endFrame()
+// that closes the last frame writes the JSON file. Events go into a buffer sized
+// at start(), so recording never allocates or locks; past its end they're
+// dropped and counted.
+class Tracer {
+public:
+    static const int MAX_THREADS = 32;
+
+private:
+    struct Event {
+        const char* name;
+        Uint64 start;     // performance counter ticks
+        Uint64 end;       // same as start for counters
+        double value;     // counters only
+        int thread;
+        char phase;       // 'X' slice, 'C' counter
+    };
+
+    std::unique_ptr<Event[]> events;
+    size_t capacity;
+    std::atomic<size_t> used;
+    std::atomic<size_t> dropped;
+    std::atomic<int> writers;   // threads between the recording check and their event
+
+    int framesLeft;
+    Uint64 captureStart;
+    std::string path;
+
+    const char* threadNames[MAX_THREADS];
+    bool released[MAX_THREADS];  // track left by a thread that has exited, free for the next of its name
+    std::atomic<int> threadCount;
+    std::mutex nameMutex;  // naming and releasing against each other, and write()
+
+    static std::atomic<bool> recording;
+    static Tracer* instance;
+
+    Tracer();  // Private constructor for singleton
+
+    int threadIndex();
+    void push(const Event& event);
+    bool write();
+
+public:
+    static Tracer* getInstance();
+
+    static bool isRecording() { return recording.load(std::memory_order_relaxed); }
+
+    // Capture the next frames frames into outputPath. Ignored while a capture runs.
+    void start(int frames, const std::string& outputPath);
+
+    // Name the calling thread's track; name must be a literal. If an exited
+    // thread released a track of the same name, this thread takes it over.
+    void setThreadName(const char* name);
+
+    // Give up the calling thread's track as it exits, so threads that replace
+    // each other (one simulation thread per match) don't use up a slot each.
+    // Threads running at the same time keep tracks of their own.
+    void releaseThreadName();
+
+    void complete(const char* name, Uint64 start, Uint64 end);
+    void counter(const char* name, double value);
+
+    // Main thread, once per presented frame; writes the file after the last one
+    void endFrame();
+};
+
+class TraceScope {
+private:
+    const char* name;
+    Uint64 start;
+
+public:
+    explicit TraceScope(const char* scopeName)
+        : name(scopeName), start(Tracer::isRecording() ? SDL_GetPerformanceCounter() : 0) {}
+
+    ~TraceScope() {
+        if (start != 0) {
+            Tracer::getInstance()->complete(name, start, SDL_GetPerformanceCounter());
+        }
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+};
+
+#endif // TRACER_H
@@ -0,0 +1,391 @@
+#include "World.h"
+#include "Profiler.h"
+#include "Tracer.h"
+#include <cmath>
+
+const int World::WIDTH;
+const int World::HEIGHT;
+const int World::MAX_SWARM_WASPS;
+
+static uint32_t pickSeed(uint32_t seed) {
+    return seed != 0 ? seed : std::random_device{}();
+}
+
+World::World(const GameOptions& gameOptions, SDL_Renderer* worldRenderer, std::shared_ptr<TerrainGrid> sharedTerrain)
+    : options(gameOptions),
+      seed(pickSeed(gameOptions.seed)),
+      renderer(worldRenderer),
+      waspTexture(nullptr),
+      turtleTexture(nullptr),
+      frog(WIDTH / 2.0f, HEIGHT / 2.0f),
+      enemyProjectiles(WIDTH, HEIGHT),
+      swarm(MAX_SWARM_WASPS, WIDTH, HEIGHT),
+      terrain(sharedTerrain),
+      spawnDirector(seed, WIDTH, HEIGHT),
+      wanderRng(seed ^ 0x9e3779b9u) {
+    // The same seed replays the same map, waves, turtle wandering, pellets and ripples
+    if (!terrain) {
+        terrain = std::make_shared<TerrainGrid>(renderer, 64, 36, 20, seed);
+    }
+    if (options.rainDrops < 0) {
+        rainSystem = std::make_unique<RainSystem>(WIDTH, HEIGHT, 0, seed);
+    } else if (options.rainDrops > 0) {
+        rainSystem = std::make_unique<RainSystem>(WIDTH, HEIGHT, options.rainDrops, seed);
+    }
+    waterPhysics = std::make_unique<WaterPhysics>(renderer, seed);
+    shotgun = std::make_unique<DefaultShotgun>(renderer, seed);
+    if (renderer) {
+        frog.initializeHealthBar(renderer, FROG_MAX_HEALTH);
+    } else {
+        // Headless worlds are batch runs: no wall-clock AI budget, so a seed
+        // plays out the same however busy the cores are
+        aiScheduler.setTimeBudget(0.0);
+    }
+
+    // Wave sizes come from the options; swarm mode lifts the wasp cap to the swarm's size
+    WaveConfig waspWaves = spawnDirector.getConfig(SpawnType::WASP);
+    waspWaves.perWave = options.waspsPerSpawn;
+    if (options.swarmMode) {
+        waspWaves.budget = MAX_SWARM_WASPS;
+    }
+    if (options.maxWasps >= 0) {
+        waspWaves.budget = options.maxWasps;
+    }
+    spawnDirector.configure(SpawnType::WASP, waspWaves);
+
+    WaveConfig turtleWaves = spawnDirector.getConfig(SpawnType::TURTLE);
+    if (options.maxTurtles >= 0) {
+        turtleWaves.budget = options.maxTurtles;
+    }
+    spawnDirector.configure(SpawnType::TURTLE, turtleWaves);
+    spawnDirector.reset();
+
+    // Every enemy the budgets allow is built here, so spawning mid-fight never allocates
+    wasps.resize(waspWaves.budget);
+    turtles.resize(turtleWaves.budget);
+}
+
+void World::setEnemyTextures(SDL_Texture* wasp, SDL_Texture* turtle) {
+    waspTexture = wasp;
+    turtleTexture = turtle;
+}
+
+void World::jumpFrog(int xDir, int yDir) {
+    if (frog.getGrounded()) {
+        frog.jump(static_cast<float>(xDir), static_cast<float>(yDir));
+    }
+}
+
+void World::grappleFrog(int x, int y) {
+    frog.grapple(x, y);
+}
+
+void World::shootAt(int x, int y) {
+    SDL_Rect frogBox = frog.getCollisionBox();
+    shotgun->shoot(frogBox.x + frogBox.w/2, frogBox.y + frogBox.h/2, x, y);
+    stats.shots++;
+}
+
+void World::reloadGun() {
+    shotgun->reload();
+}
+
+void World::aimGun(int x, int y) {
+    SDL_Rect frogBox = frog.getCollisionBox();
+    shotgun->updateGunPosition(frogBox.x + frogBox.w/2, frogBox.y + frogBox.h/2, x, y);
+}
+
+void World::spawnWaspAt(int x, int y) {
+    int before = wasps.size();
+    Wasp::spawnWasp(wasps, x, y, waspTexture, renderer);
+    stats.waspsSpawned += wasps.size() - before;
+}
+
+void World::spawnTurtleAt(int x, int y) {
+    int before = turtles.size();
+    Turtle::spawnTurtle(turtles, x, y, turtleTexture, renderer);
+    stats.turtlesSpawned += turtles.size() - before;
+}
+
+void World::spawnEnemyBullet(float x, float y, float velocityX, float velocityY) {
+    enemyProjectiles.requestSpawn(x, y, velocityX, velocityY);
+}
+
+void World::hurtFrog(int damage) {
+    stats.frogHits++;
+    if (options.invulnerable) return;
+    frog.takeDamage(damage);
+    stats.frogDamage += damage;
+    flash.startFlash(&frog); // Start flash effect
+}
+
+void World::checkBulletCollisions() {
+    auto& shotgunBullets = shotgun->getBullets();
+
+    // Check wasp collisions
+    for (auto& wasp : wasps) {
+        if (!wasp.active) continue;
+
+        SDL_Rect waspBox = wasp.rect;
+        for (const auto& bullet : shotgunBullets) {
+            if (SDL_HasIntersection(&bullet.bulletPos, &waspBox)) {
+                wasp.takeDamage(bullet.bulletDamage);
+                flash.startFlash(&wasp); // Start flash effect
+                break;
+            }
+        }
+    }
+
+    // Check turtle collisions
+    for (auto& turtle : turtles) {
+        if (turtle.hiding) continue;
+
+        SDL_Rect turtleBox = turtle.rect;
+        for (const auto& bullet : shotgunBullets) {
+            if (SDL_HasIntersection(&bullet.bulletPos, &turtleBox)) {
+                turtle.takeDamage(bullet.bulletDamage);
+                flash.startFlash(&turtle); // Start flash effect
+                break;
+            }
+        }
+    }
+}
+
+void World::checkEnemyCollisions() {
+    SDL_Rect frogBox = frog.getCollisionBox();
+
+    // Check wasp collisions
+    for (auto& wasp : wasps) {
+        if (!wasp.active || wasp.pendingRemoval) continue;
+
+        if (SDL_HasIntersection(&wasp.rect, &frogBox) && wasp.canDealDamage()
+            && frog.getState() != Frog::State::JUMPING) {
+            hurtFrog(WASP_DAMAGE);
+            wasp.resetDamageTimer();
+        }
+    }
+}
+
+// Swarm mode: run every live wasp through the boids update, then copy the
+// new positions back onto the wasps (agents are added in pool order)
+void World::steerSwarm(float deltaTime) {
+    swarm.clear();
+    for (const auto& wasp : wasps) {
+        if (!wasp.active || wasp.pendingRemoval) continue;
+        swarm.add(wasp.rect.x + wasp.rect.w / 2.0f, wasp.rect.y + wasp.rect.h / 2.0f,
+                  wasp.dx / deltaTime, wasp.dy / deltaTime);
+    }
+
+    SDL_Rect frogRect = frog.getCollisionBox();
+    swarm.update(deltaTime, frogRect.x + frogRect.w / 2.0f, frogRect.y + frogRect.h / 2.0f);
+
+    int agent = 0;
+    for (auto& wasp : wasps) {
+        if (!wasp.active || wasp.pendingRemoval) continue;
+        if (agent >= swarm.size()) break;  // Swarm was full
+
+        // dx/dy stay in pixels per frame like moveTowards
+        wasp.dx = swarm.getVelocityX(agent) * deltaTime;
+        wasp.dy = swarm.getVelocityY(agent) * deltaTime;
+        wasp.rect.x = static_cast<int>(std::lround(swarm.getX(agent) - wasp.rect.w / 2.0f));
+        wasp.rect.y = static_cast<int>(std::lround(swarm.getY(agent) - wasp.rect.h / 2.0f));
+        if (wasp.dx > 0) wasp.facingRight = true;
+        if (wasp.dx < 0) wasp.facingRight = false;
+        agent++;
+    }
+}
+
+// Queue every enemy that is due a decision, then let the scheduler run as many
+// as the frame budget allows. Wasps pick a heading, turtles check whether to hide.
+void World::scheduleAI(int waspSpeed) {
+    aiScheduler.beginFrame();
+
+    SDL_Rect frogRect = frog.getCollisionBox();
+    float frogX = frogRect.x + frogRect.w / 2.0f;
+    float frogY = frogRect.y + frogRect.h / 2.0f;
+    SDL_Rect screen = {0, 0, WIDTH, HEIGHT};
+
+    if (!options.swarmMode) {  // The swarm steers every wasp itself
+        for (int i = 0; i < static_cast<int>(wasps.size()); i++) {
+            Wasp& wasp = wasps[i];
+            if (!wasp.active || wasp.pendingRemoval) continue;
+            float dx = wasp.rect.x + wasp.rect.w / 2.0f - frogX;
+            float dy = wasp.rect.y + wasp.rect.h / 2.0f - frogY;
+            aiScheduler.request(AIKind::WASP, i, wasp.ai, dx * dx + dy * dy,
+                                SDL_HasIntersection(&wasp.rect, &screen));
+        }
+    }
+    for (int i = 0; i < static_cast<int>(turtles.size()); i++) {
+        Turtle& turtle = turtles[i];
+        if (turtle.pendingRemoval) continue;
+        float dx = turtle.rect.x + turtle.rect.w / 2.0f - frogX;
+        float dy = turtle.rect.y + turtle.rect.h / 2.0f - frogY;
+        aiScheduler.request(AIKind::TURTLE, i, turtle.ai, dx * dx + dy * dy,
+                            SDL_HasIntersection(&turtle.rect, &screen));
+    }
+
+    aiScheduler.dispatch(
+        [&](AIKind kind, int index) {
+            if (kind == AIKind::WASP) {
+                wasps[index].think(frog, waspSpeed);
+            } else {
+                turtles[index].hideinShell(frog);
+            }
+        },
+        [&](AIKind kind, int index) -> AIState& {
+            return kind == AIKind::WASP ? wasps[index].ai : turtles[index].ai;
+        });
+}
+
+void World::updateWasps(int speed) {
+    // Dead wasps go back to the pool; their slot is reused by the next spawn
+    int before = wasps.size();
+    wasps.releaseIf([](const Wasp& wasp) { return !wasp.active || wasp.pendingRemoval; });
+    stats.waspsKilled += before - wasps.size();
+
+    for (auto& wasp : wasps) {
+        if (!options.swarmMode) {
+            wasp.integrate();  // Heading comes from scheduleAI; swarm mode already moved it
+        }
+        wasp.updateHealthBar();
+        wasp.updateDamageTimer(1.0f/60.0f); // Update damage cooldown timer
+    }
+}
+
+void World::updateTurtles() {
+    int before = turtles.size();
+    turtles.releaseIf([](const Turtle& turtle) { return turtle.pendingRemoval; });
+    stats.turtlesKilled += before - turtles.size();
+
+    for (auto& turtle : turtles) {
+        turtle.updateMovement(flowField.get(), wanderRng);  // Hiding is decided in scheduleAI
+        turtle.updateHealthBar();
+        turtle.fireBullet(enemyProjectiles, frog);
+    }
+}
+
+void World::updateBullets(float deltaTime) {
+    // Move and cull every turt bullet once, then apply hits on the frog
+    enemyProjectiles.update(deltaTime);
+
+    int hits = enemyProjectiles.collideWith(frog.getCollisionBox());
+    for (int i = 0; i < hits; i++) {
+        // Apply damage to the frog when hit by a bullet
+        hurtFrog(BULLET_DAMAGE);
+    }
+}
+
+void World::update(float deltaTime) {
+    stats.ticks++;
+
+    // Update flash effects
+    {
+        PROFILE_SCOPE("update.flash");
+        flash.update(deltaTime);
+    }
+
+    // Update rain
+    if (rainSystem) {
+        PROFILE_SCOPE("update.rain");
+        rainSystem->update(deltaTime);
+    }
+
+    // Update water physics and check if frog is on water
+    {
+        PROFILE_SCOPE("update.water");
+        waterPhysics->update(deltaTime, *terrain);
+
+        // Check if frog is on water and update its state
+        SDL_Rect frogBox = frog.getCollisionBox();
+        int gridX = frogBox.x / terrain->getCellSize();
+        int gridY = frogBox.y / terrain->getCellSize();
+        bool isOnWater = terrain->isWater(gridX, gridY);
+
+        // Update frog's water state
+        frog.setOnWater(isOnWater);
+
+        // Add water ring at frog's position if on water
+        if (isOnWater) {
+            waterPhysics->addFrogRing(frogBox.x + frogBox.w/2, frogBox.y + frogBox.h/2);
+        }
+    }
+
+    // Update frog's position and state
+    {
+        PROFILE_SCOPE("update.frog");
+        frog.update(deltaTime);
+    }
+
+    // Check enemy collisions if frog is alive
+    if (frog.getState() != Frog::State::DEAD) {
+        PROFILE_SCOPE("update.collisions");
+        checkEnemyCollisions();
+    }
+
+    // Update shotgun and check for bullet collisions
+    {
+        PROFILE_SCOPE("update.shotgun");
+        shotgun->update(deltaTime);
+        {
+            TRACE_SCOPE("shotgun.updateBullets");
+            shotgun->updateBullets();
+        }
+        TRACE_SCOPE("shotgun.collisions");
+        checkBulletCollisions();
+    }
+
+    // Spawn whatever waves came due this tick
+    {
+        PROFILE_SCOPE("update.spawn");
+        spawnDirector.setTerrain(*terrain);  // Only rebuilds when the map changed
+        SDL_Rect frogRect = frog.getCollisionBox();
+        const auto& spawns = spawnDirector.update(deltaTime, frogRect.x + frogRect.w / 2.0f,
+                                                  frogRect.y + frogRect.h / 2.0f,
+                                                  wasps.size(), turtles.size());
+        for (const SpawnRequest& spawn : spawns) {
+            if (spawn.type == SpawnType::WASP) {
+                spawnWaspAt(spawn.x, spawn.y);
+            } else {
+                spawnTurtleAt(spawn.x, spawn.y);
+            }
+        }
+    }
+
+    // Enemy decisions for this tick, then movement for everyone
+    {
+        PROFILE_SCOPE("update.ai");
+        scheduleAI(3);
+    }
+
+    // Update wasps
+    {
+        PROFILE_SCOPE("update.wasps");
+        if (options.swarmMode && deltaTime > 0.0f) {
+            steerSwarm(deltaTime);
+        }
+        updateWasps(3);
+    }
+
+    // Rebuild the turtles' flow field only when the frog reaches a new cell
+    {
+        PROFILE_SCOPE("update.flowfield");
+        if (!flowField) {
+            flowField = std::make_unique<FlowField>(terrain->getWidth(), terrain->getHeight(),
+                                                    terrain->getCellSize());
+        }
+        SDL_Rect frogBox = frog.getCollisionBox();
+        flowField->update(*terrain, frogBox.x + frogBox.w / 2, frogBox.y + frogBox.h / 2);
+    }
+
+    // Update turtles (they queue their shots with the projectile system)
+    {
+        PROFILE_SCOPE("update.turtles");
+        updateTurtles();
+    }
+
+    // Update turt bullets
+    {
+        PROFILE_SCOPE("update.bullets");
+        updateBullets(deltaTime);
+    }
+}
@@ -0,0 +1,139 @@
+#ifndef WORLD_H
+#define WORLD_H
+
+#include "frog/frogClass.h"
+#include "turtle/turtleStruct.h"
+#include "turtle/turtBullet/EnemyProjectiles.h"
+#include "wasp/waspStruct.h"
+#include "wasp/WaspSwarm.h"
+#include "guns/DefaultShotgun.h"
+#include "terrain/TerrainGrid.h"
+#include "terrain/FlowField.h"
+#include "RainSystem.h"
+#include "waterPhysics.h"
+#include "hurtFlash.h"
+#include "GameOptions.h"
+#include "ai/AIScheduler.h"
+#include "SpawnDirector.h"
+#include "EntityPool.h"
+#include <SDL2/SDL.h>
+#include <cstdint>
+#include <memory>
+#include <random>
+
+// What happened in a world so far; batch runs compare these across seeds
+struct WorldStats {
+    int ticks = 0;
+    int waspsSpawned = 0;
+    int turtlesSpawned = 0;
+    int waspsKilled = 0;
+    int turtlesKilled = 0;
+    int frogHits = 0;        // counted even when the frog is invulnerable
+    int frogDamage = 0;
+    int shots = 0;
+};
+
+// One match's simulation: the frog, enemies, projectiles, terrain, water, rain
+// and every timer and random generator they use. Nothing is shared between
+// worlds, so any number can be stepped at once on different threads
+// (bench/BatchRunner.h); gameplay owns one and draws it.
+//
+// With a renderer the world also loads the textures its parts draw with and
+// gives enemies health bars; without one (headless) it only simulates.
+// Build worlds on the main thread (construction goes through the AssetManager
+// and the terrain's texture), then step each from one thread at a time.
+class World {
+public:
+    static const int WIDTH = 1280;
+    static const int HEIGHT = 720;
+    static const int MAX_SWARM_WASPS = 8192;
+
+    // terrain is shared with whoever made it (the menu); without one the world
+    // generates its own from options.seed
+    World(const GameOptions& options, SDL_Renderer* renderer = nullptr,
+          std::shared_ptr<TerrainGrid> terrain = nullptr);
+
+    // Drawn on newly spawned enemies; headless worlds leave them null
+    void setEnemyTextures(SDL_Texture* wasp, SDL_Texture* turtle);
+
+    // One tick of everything
+    void update(float deltaTime);
+
+    // Frog actions, for input handling and scripted runs
+    void jumpFrog(int xDir, int yDir);
+    void grappleFrog(int x, int y);
+    void shootAt(int x, int y);
+    void reloadGun();
+    void aimGun(int x, int y);  // Where the mouse is; shells eject from the aimed gun
+
+    // Direct placement, for scenario and batch runs
+    void spawnWaspAt(int x, int y);
+    void spawnTurtleAt(int x, int y);
+    void spawnEnemyBullet(float x, float y, float velocityX, float velocityY);
+
+    // Parts, for drawing
+    Frog& getFrog() { return frog; }
+    EntityPool<Wasp>& getWasps() { return wasps; }
+    EntityPool<Turtle>& getTurtles() { return turtles; }
+    EnemyProjectiles& getEnemyProjectiles() { return enemyProjectiles; }
+    TerrainGrid* getTerrain() { return terrain.get(); }
+    RainSystem* getRain() { return rainSystem.get(); }
+    WaterPhysics* getWater() { return waterPhysics.get(); }
+    DefaultShotgun* getShotgun() { return shotgun.get(); }
+    hurtFlash& getFlash() { return flash; }
+
+    int getWaspCount() const { return wasps.size(); }
+    int getTurtleCount() const { return turtles.size(); }
+    int getEnemyBulletCount() const { return enemyProjectiles.size(); }
+    int getRainCount() const { return rainSystem ? rainSystem->size() : 0; }
+    int getPelletCount() const { return shotgun ? shotgun->getBullets().size() : 0; }
+    int getWaterRingCount() const { return waterPhysics ? waterPhysics->size() : 0; }
+    int getTrailParticleCount() const { return shotgun ? shotgun->getTrailParticleCount() : 0; }
+    SDL_Rect getFrogBox() const { return frog.getCollisionBox(); }
+    bool isFrogDead() const { return frog.getState() == Frog::State::DEAD; }
+    uint32_t getSeed() const { return seed; }
+    const WorldStats& getStats() const { return stats; }
+
+private:
+    // Damage constants
+    static const int WASP_DAMAGE = 10;
+    static const int BULLET_DAMAGE = 30;
+    static const int FROG_MAX_HEALTH = 100;
+
+    GameOptions options;
+    uint32_t seed;
+    SDL_Renderer* renderer;       // null when headless
+    SDL_Texture* waspTexture;
+    SDL_Texture* turtleTexture;
+
+    hurtFlash flash;              // Red tint timers for whatever was just hit
+    Frog frog;
+
+    // Pools holding active wasps and turtles, sized to the spawn budgets
+    EntityPool<Wasp> wasps;
+    EntityPool<Turtle> turtles;
+    EnemyProjectiles enemyProjectiles;  // Every turtle bullet, moved once per tick
+    WaspSwarm swarm;  // Steering for every wasp in swarm mode, refilled each tick
+
+    std::shared_ptr<TerrainGrid> terrain;
+    std::unique_ptr<RainSystem> rainSystem;
+    std::unique_ptr<WaterPhysics> waterPhysics;
+    std::unique_ptr<FlowField> flowField;  // Ground enemies' path to the frog
+    std::unique_ptr<DefaultShotgun> shotgun;
+    AIScheduler aiScheduler;  // Who gets to make a decision this tick
+    SpawnDirector spawnDirector;  // When and where enemies appear
+    std::mt19937 wanderRng;  // Turtles' random walk when there's no flow field
+
+    WorldStats stats;
+
+    void hurtFrog(int damage);
+    void checkBulletCollisions();
+    void checkEnemyCollisions();
+    void steerSwarm(float deltaTime);
+    void scheduleAI(int waspSpeed);
+    void updateWasps(int speed);
+    void updateTurtles();
+    void updateBullets(float deltaTime);
+};
+
+#endif // WORLD_H
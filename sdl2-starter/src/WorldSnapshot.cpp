@@ -0,0 +1,55 @@
+#include "WorldSnapshot.h"
+
+WorldSnapshot::WorldSnapshot(World& world)
+    : tick(0),
+      terrain(world.getTerrain()),
+      enemyProjectiles(world.getEnemyProjectiles()),
+      shotgun(std::make_unique<DefaultShotgun>(*world.getShotgun())) {
+    wasps.reserve(world.getWasps().capacity());
+    turtles.reserve(world.getTurtles().capacity());
+    if (world.getRain()) {
+        rain = std::make_unique<RainSystem>(*world.getRain());
+    }
+    if (world.getWater()) {
+        water = std::make_unique<WaterPhysics>(*world.getWater());
+    }
+    capture(world);
+}
+
+void WorldSnapshot::capture(World& world) {
+    hurtFlash& flash = world.getFlash();
+    tick = world.getStats().ticks;
+
+    Frog& liveFrog = world.getFrog();
+    frog.box = liveFrog.getCollisionBox();
+    frog.frame = liveFrog.getCurrentFrame();
+    frog.texture = liveFrog.getCurrentTexture();
+    frog.facing = liveFrog.getFacing();
+    frog.state = liveFrog.getState();
+    frog.grappleX = liveFrog.getGrappleX();
+    frog.grappleY = liveFrog.getGrappleY();
+    frog.flash = flash.getRemaining(&liveFrog);
+    frog.hasHealth = liveFrog.copyHealthBar(frog.health);
+
+    // Only what gets drawn: enemies on their way out are skipped
+    wasps.clear();
+    for (Wasp& wasp : world.getWasps()) {
+        if (wasp.pendingRemoval) continue;
+        wasps.push_back({wasp.rect, wasp.texture, wasp.facingRight, false, wasp.active,
+                         flash.getRemaining(&wasp), wasp.health});
+    }
+    turtles.clear();
+    for (Turtle& turtle : world.getTurtles()) {
+        if (turtle.pendingRemoval) continue;
+        turtles.push_back({turtle.rect, nullptr, turtle.facingRight, turtle.hiding, !turtle.hiding,
+                           flash.getRemaining(&turtle), turtle.health});
+    }
+
+    // The particle systems copy into their twins, reusing the twins' storage
+    terrain = world.getTerrain();
+    enemyProjectiles.reserve(world.getEnemyProjectiles().capacity());  // Grows with the live one, not past it
+    enemyProjectiles = world.getEnemyProjectiles();
+    if (rain) *rain = *world.getRain();
+    if (water) *water = *world.getWater();
+    *shotgun = *world.getShotgun();
+}
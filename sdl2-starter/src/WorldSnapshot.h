@@ -0,0 +1,62 @@
+#ifndef WORLD_SNAPSHOT_H
+#define WORLD_SNAPSHOT_H
+
+#include "World.h"
+#include "healthBar.cpp"
+#include <SDL2/SDL.h>
+#include <memory>
+#include <vector>
+
+// Everything gameplay draws for one tick, copied out of a World. The world is
+// the back buffer the simulation thread writes the next tick into; this is the
+// front buffer the main thread draws from meanwhile (SimulationThread.h).
+// Nothing here points back into the world except textures and the terrain,
+// which the simulation only reads.
+//
+// Buffers are sized from the world's pools when the snapshot is made, so
+// capture() copies into memory that is already there.
+class WorldSnapshot {
+public:
+    struct FrogView {
+        SDL_Rect box;              // where it's drawn, jump included
+        SDL_Rect frame;            // source rect in the spritesheet
+        SDL_Texture* texture;
+        Frog::Direction facing;
+        Frog::State state;
+        float grappleX, grappleY;
+        float flash;               // seconds of hurt flash left
+        healthBar health;
+        bool hasHealth;
+
+        FrogView()
+            : box(), frame(), texture(nullptr), facing(Frog::Direction::LEFT), state(Frog::State::IDLE),
+              grappleX(0.0f), grappleY(0.0f), flash(0.0f), health(nullptr), hasHealth(false) {}
+    };
+
+    struct EnemyView {
+        SDL_Rect rect;
+        SDL_Texture* texture;      // a wasp's own; turtles are drawn with gameplay's
+        bool facingRight;
+        bool hiding;               // turtles in their shell
+        bool showHealth;
+        float flash;
+        healthBar health;
+    };
+
+    explicit WorldSnapshot(World& world);
+
+    // Copy the world's current state in; the world must not be updating
+    void capture(World& world);
+
+    int tick;
+    FrogView frog;
+    std::vector<EnemyView> wasps;
+    std::vector<EnemyView> turtles;
+    TerrainGrid* terrain;
+    EnemyProjectiles enemyProjectiles;
+    std::unique_ptr<RainSystem> rain;      // null when the world has none
+    std::unique_ptr<WaterPhysics> water;
+    std::unique_ptr<DefaultShotgun> shotgun;
+};
+
+#endif // WORLD_SNAPSHOT_H
@@ -0,0 +1,155 @@
+#ifndef AI_SCHEDULER_H
+#define AI_SCHEDULER_H
+
+#include <SDL2/SDL.h>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+
+// Per-enemy scheduling state, kept inside the enemy struct so it survives copies
+struct AIState {
+    int lastThinkFrame = -1000000;  // frame of the last decision (far past = think soon)
+    int period = 1;                 // frames between decisions, set from the LOD tier
+    uint8_t phase = 0;              // round-robin bucket, spreads agents of a tier across frames
+    bool assigned = false;          // phase handed out by the scheduler yet
+};
+
+// What kind of enemy a request came from, so the dispatch callback knows which
+// container the index belongs to
+enum class AIKind : uint8_t {
+    WASP,
+    TURTLE
+};
+
+// Decides which enemies get to run their (expensive) decision step each frame.
+// Each enemy gets a think period from its distance to the frog: close ones decide
+// every frame, far or off-screen ones every few frames, and the round-robin
+// phase spreads a tier's enemies evenly across those frames. Decisions are then
+// run most-overdue first until the per-frame decision or time budget runs out;
+// whatever is left stays due and goes to the front of the line next frame.
+// Between decisions enemies keep moving on their last heading. A time budget of
+// 0 caps decisions by count only, so who thinks doesn't depend on the machine.
+class AIScheduler {
+public:
+    struct Tier {
+        float radius;  // pixels from the frog, upper bound of this tier
+        int period;    // frames between decisions
+    };
+
+private:
+    struct Request {
+        AIKind kind;
+        int index;
+        int lateness;  // how late, in sixteenths of the agent's period; larger runs first
+    };
+
+    static const int NUM_TIERS = 3;
+    Tier tiers[NUM_TIERS];
+    int offscreenPeriod;
+
+    int maxDecisions;
+    double budgetMs;
+
+    std::vector<Request> requests;
+    int frame;
+    int nextPhase;
+
+    // Stats for the last dispatched frame
+    int decisions;
+    int deferred;
+
+public:
+    AIScheduler(int maxDecisionsPerFrame = 256, double frameBudgetMs = 0.5, int capacity = 4096)
+        : offscreenPeriod(16), maxDecisions(maxDecisionsPerFrame), budgetMs(frameBudgetMs),
+          frame(0), nextPhase(0), decisions(0), deferred(0) {
+        tiers[0] = {200.0f, 1};    // in reach of the frog: every frame
+        tiers[1] = {500.0f, 4};
+        tiers[2] = {1e9f, 8};      // anywhere else on screen
+        requests.reserve(capacity);
+    }
+
+    // Start a new tick; call before any request()
+    void beginFrame() {
+        frame++;
+        requests.clear();
+    }
+
+    // Update the enemy's tier from its squared distance to the frog (no sqrt) and
+    // queue it if it's due this frame. Returns true if it was queued.
+    bool request(AIKind kind, int index, AIState& state, float distanceSq, bool onScreen) {
+        if (!state.assigned) {
+            // New enemy: give it the next round-robin bucket
+            state.phase = static_cast<uint8_t>(nextPhase++ & 0xFF);
+            state.assigned = true;
+        }
+
+        int period = offscreenPeriod;
+        if (onScreen) {
+            for (int t = 0; t < NUM_TIERS; t++) {
+                if (distanceSq <= tiers[t].radius * tiers[t].radius) {
+                    period = tiers[t].period;
+                    break;
+                }
+            }
+        }
+        state.period = period;
+
+        // Due on its own round-robin bucket, or overdue because the budget ran
+        // out or its tier just changed
+        int waited = frame - state.lastThinkFrame;
+        bool onPhase = (frame + state.phase) % period == 0;
+        if (waited <= 0 || !(onPhase || waited > period)) {
+            return false;
+        }
+
+        // Requests grow to the reserved capacity only if there are more enemies than that
+        // Lateness is relative to the period, so a close enemy one frame late
+        // outranks a distant one a frame late
+        requests.push_back({kind, index, std::min(waited, 1000000) * 16 / period});
+        return true;
+    }
+
+    // Run think(kind, index) for queued enemies, most overdue first, until the
+    // decision or time budget is spent. stateOf(kind, index) returns the enemy's
+    // AIState so its think time can be recorded. Returns the number of decisions made.
+    template <typename ThinkFn, typename StateFn>
+    int dispatch(ThinkFn think, StateFn stateOf) {
+        std::sort(requests.begin(), requests.end(),
+                  [](const Request& a, const Request& b) { return a.lateness > b.lateness; });
+
+        Uint64 start = SDL_GetPerformanceCounter();
+        Uint64 budgetTicks = static_cast<Uint64>(budgetMs * SDL_GetPerformanceFrequency() / 1000.0);
+
+        decisions = 0;
+        for (const Request& r : requests) {
+            if (decisions >= maxDecisions) break;
+
+            // Reading the clock costs more than a decision, so check every 16
+            if (budgetTicks > 0 && (decisions & 15) == 15 && SDL_GetPerformanceCounter() - start > budgetTicks) break;
+
+            think(r.kind, r.index);
+            stateOf(r.kind, r.index).lastThinkFrame = frame;
+            decisions++;
+        }
+        deferred = static_cast<int>(requests.size()) - decisions;
+        return decisions;
+    }
+
+    void setTier(int tier, float radius, int period) {
+        if (tier >= 0 && tier < NUM_TIERS) {
+            tiers[tier] = {radius, std::max(period, 1)};
+        }
+    }
+    void setOffscreenPeriod(int period) { offscreenPeriod = std::max(period, 1); }
+    void setBudget(int maxDecisionsPerFrame, double frameBudgetMs) {
+        maxDecisions = maxDecisionsPerFrame;
+        budgetMs = frameBudgetMs;
+    }
+    void setTimeBudget(double frameBudgetMs) { budgetMs = frameBudgetMs; }
+
+    int getFrame() const { return frame; }
+    int getDecisions() const { return decisions; }
+    int getDeferred() const { return deferred; }
+};
+
+#endif // AI_SCHEDULER_H
@@ -0,0 +1,162 @@
+#include "BatchRunner.h"
+#include "BenchReport.h"
+#include "ScriptedPilot.h"
+#include "../Profiler.h"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <thread>
+
+static const float STEP = 1.0f / 60.0f;  // Same fixed step as scenario runs
+
+BatchRunner::BatchRunner(const BatchConfig& cfg)
+    : config(cfg), nextWorld(0) {
+    config.worlds = std::max(config.worlds, 1);
+}
+
+void BatchRunner::runWorld(int index) {
+    World& world = *worlds[index];
+    Result& result = results[index];
+
+    Uint64 start = BenchReport::now();
+    for (int tick = 0; tick < config.ticks && !world.isFrogDead(); tick++) {
+        ScriptedPilot::step(world, tick);
+        world.update(STEP);
+    }
+    result.ms = BenchReport::elapsedMs(start, BenchReport::now());
+    result.stats = world.getStats();
+    result.frogDied = world.isFrogDead();
+}
+
+void BatchRunner::work() {
+    // Worlds that end early (a dead frog) free their thread for the next one
+    for (int index = nextWorld++; index < config.worlds; index = nextWorld++) {
+        runWorld(index);
+    }
+}
+
+static bool sameStats(const WorldStats& a, const WorldStats& b) {
+    return a.ticks == b.ticks && a.waspsSpawned == b.waspsSpawned && a.turtlesSpawned == b.turtlesSpawned &&
+           a.waspsKilled == b.waspsKilled && a.turtlesKilled == b.turtlesKilled && a.frogHits == b.frogHits &&
+           a.frogDamage == b.frogDamage && a.shots == b.shots;
+}
+
+BatchRunner::Totals BatchRunner::totals() const {
+    Totals all;
+    for (const Result& result : results) {
+        all.ticks += result.stats.ticks;
+        all.worldMs += result.ms;
+        all.deaths += result.frogDied ? 1 : 0;
+    }
+    return all;
+}
+
+bool BatchRunner::writeJson(int threads, double wallMs) const {
+    std::ofstream out(config.jsonPath);
+    if (!out) return false;
+    out.setf(std::ios::fixed);
+    out.precision(4);
+
+    Totals all = totals();
+
+    out << "{\n";
+    out << "  \"batch\": {\"worlds\": " << config.worlds << ", \"threads\": " << threads
+        << ", \"ticks\": " << config.ticks << ", \"seed\": " << config.seed
+        << ", \"swarm\": " << (config.options.swarmMode ? "true" : "false")
+        << ", \"rain\": " << config.options.rainDrops << "},\n";
+    out << "  \"wall_ms\": " << wallMs << ",\n";
+    out << "  \"world_ms\": " << all.worldMs << ",\n";
+    out << "  \"world_ticks\": " << all.ticks << ",\n";
+    out << "  \"world_ticks_per_second\": " << (wallMs > 0.0 ? all.ticks * 1000.0 / wallMs : 0.0) << ",\n";
+    out << "  \"frog_deaths\": " << all.deaths << ",\n";
+    out << "  \"worlds\": [";
+    for (int i = 0; i < config.worlds; i++) {
+        const Result& result = results[i];
+        const WorldStats& stats = result.stats;
+        out << (i == 0 ? "\n" : ",\n") << "    {\"seed\": " << worlds[i]->getSeed()
+            << ", \"ticks\": " << stats.ticks << ", \"frog_died\": " << (result.frogDied ? "true" : "false")
+            << ", \"ms\": " << result.ms << ", \"wasps_spawned\": " << stats.waspsSpawned
+            << ", \"wasps_killed\": " << stats.waspsKilled << ", \"turtles_spawned\": " << stats.turtlesSpawned
+            << ", \"turtles_killed\": " << stats.turtlesKilled << ", \"frog_hits\": " << stats.frogHits
+            << ", \"frog_damage\": " << stats.frogDamage << ", \"shots\": " << stats.shots << "}";
+    }
+    out << "\n  ]\n";
+    out << "}\n";
+    return static_cast<bool>(out);
+}
+
+double BatchRunner::runAll(int threads) {
+    // Built here, not on the workers: terrain generation and the profiler's
+    // singleton are set up once, from one thread
+    Profiler::getInstance();
+    worlds.clear();
+    worlds.reserve(config.worlds);
+    for (int i = 0; i < config.worlds; i++) {
+        GameOptions options = config.options;
+        options.seed = config.seed + i;
+        if (options.seed == 0) options.seed = 1;  // 0 would mean a random seed
+        worlds.push_back(std::make_unique<World>(options));
+    }
+    results.assign(config.worlds, Result());
+    nextWorld = 0;
+
+    Uint64 start = BenchReport::now();
+    std::vector<std::thread> pool;
+    for (int i = 1; i < threads; i++) {
+        pool.emplace_back(&BatchRunner::work, this);
+    }
+    work();  // This thread takes worlds too
+    for (std::thread& thread : pool) {
+        thread.join();
+    }
+    return BenchReport::elapsedMs(start, BenchReport::now());
+}
+
+bool BatchRunner::verify() {
+    std::vector<Result> first = results;
+    runAll(1);
+
+    int mismatches = 0;
+    for (int i = 0; i < config.worlds; i++) {
+        if (sameStats(first[i].stats, results[i].stats) && first[i].frogDied == results[i].frogDied) continue;
+        if (mismatches++ < 10) {
+            std::cout << "Seed " << worlds[i]->getSeed() << " differs on one thread: " << first[i].stats.ticks
+                      << " vs " << results[i].stats.ticks << " ticks, " << first[i].stats.waspsKilled << " vs "
+                      << results[i].stats.waspsKilled << " wasps killed, " << first[i].stats.frogHits << " vs "
+                      << results[i].stats.frogHits << " frog hits" << std::endl;
+        }
+    }
+    results = first;  // Report the timed run, not the rerun
+    if (mismatches > 0) {
+        std::cout << "Verify: " << mismatches << " of " << config.worlds << " worlds differ" << std::endl;
+        return false;
+    }
+    std::cout << "Verify: all " << config.worlds << " worlds match on one thread" << std::endl;
+    return true;
+}
+
+int BatchRunner::run() {
+    int threads = config.threads > 0 ? config.threads : static_cast<int>(std::thread::hardware_concurrency());
+    threads = std::max(1, std::min(threads, config.worlds));
+
+    std::cout << "Batch: " << config.worlds << " worlds, " << config.ticks << " ticks each, "
+              << threads << " threads, seeds " << config.seed << ".." << config.seed + config.worlds - 1
+              << std::endl;
+
+    double wallMs = runAll(threads);
+
+    Totals all = totals();
+    std::cout << "Stepped " << all.ticks << " world-ticks in " << wallMs << " ms ("
+              << static_cast<long long>(wallMs > 0.0 ? all.ticks * 1000.0 / wallMs : 0.0)
+              << " per second, " << (wallMs > 0.0 ? all.worldMs / wallMs : 0.0) << "x one thread); "
+              << all.deaths << " of " << config.worlds << " frogs died" << std::endl;
+
+    if (!writeJson(threads, wallMs)) {
+        std::cout << "Couldn't write " << config.jsonPath << std::endl;
+        return 1;
+    }
+    std::cout << "Wrote " << config.jsonPath << std::endl;
+
+    if (config.verify && !verify()) return 1;
+    return 0;
+}
@@ -0,0 +1,77 @@
+#ifndef BATCH_RUNNER_H
+#define BATCH_RUNNER_H
+
+/*********************************************
+Description: Batch run. Builds a number of headless Worlds (no window, no renderer),
+             one seed each, and steps them all at once on a pool of threads, each
+             flown by the scenario script (ScriptedPilot.h) on a fixed 60 Hz step
+             until it has run its ticks or the frog dies. Prints and writes to JSON
+             what happened in every world plus the totals and world-ticks per second,
+             for balance sweeps and soak tests over many seeds. --batch-verify then
+             runs the same seeds again on one thread and fails unless every world
+             ends with the same stats: a seed's result mustn't depend on the
+             thread count or on the other worlds.
+             Launch with: ./play --batch 64 [--threads 8] [--ticks 3600] [--seed 1]
+                                 [--swarm] [--rain 0] [--batch-verify] [--batch-json batch.json]
+*********************************************/
+
+#include "../World.h"
+#include "../GameOptions.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+struct BatchConfig {
+    int worlds = 32;
+    int threads = 0;            // 0 for one per hardware thread
+    int ticks = 3600;           // per world; a minute of play at 60 Hz
+    uint32_t seed = 1;          // world i plays seed + i
+    GameOptions options;        // rain is off unless asked for: nobody sees it
+    std::string jsonPath = "batch.json";
+    bool verify = false;        // rerun on one thread and compare every world's result
+
+    BatchConfig() { options.rainDrops = 0; }
+};
+
+class BatchRunner {
+private:
+    struct Result {
+        WorldStats stats;
+        bool frogDied = false;
+        double ms = 0.0;        // wall time spent stepping this world
+    };
+
+    struct Totals {
+        long long ticks = 0;
+        double worldMs = 0.0;   // summed over worlds; over wall time it's the speedup
+        int deaths = 0;
+    };
+
+    BatchConfig config;
+    std::vector<std::unique_ptr<World>> worlds;
+    std::vector<Result> results;   // one per world, each written by the thread that ran it
+    std::atomic<int> nextWorld;
+
+    // Take worlds off the shared counter and run each to the end
+    void work();
+    void runWorld(int index);
+
+    // Build a fresh world per seed and step them all; returns the wall time
+    double runAll(int threads);
+
+    // Rerun on one thread and compare with the results so far; true if all match
+    bool verify();
+
+    Totals totals() const;
+    bool writeJson(int threads, double wallMs) const;
+
+public:
+    explicit BatchRunner(const BatchConfig& cfg);
+
+    // Build, step and report every world; returns the process exit code
+    int run();
+};
+
+#endif // BATCH_RUNNER_H
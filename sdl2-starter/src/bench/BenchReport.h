@@ -0,0 +1,87 @@
+#ifndef BENCH_REPORT_H
+#define BENCH_REPORT_H
+
+#include <SDL2/SDL.h>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <ostream>
+#include <iomanip>
+
+// One named series of per-frame timings in milliseconds
+struct BenchSeries {
+    std::string name;
+    std::vector<double> samples;
+
+    explicit BenchSeries(const std::string& seriesName, size_t expectedSamples = 4096)
+        : name(seriesName) {
+        samples.reserve(expectedSamples);  // Keep recording allocation-free
+    }
+
+    void add(double ms) { samples.push_back(ms); }
+    void clear() { samples.clear(); }
+    size_t count() const { return samples.size(); }
+
+    double mean() const {
+        if (samples.empty()) return 0.0;
+        double total = 0.0;
+        for (double s : samples) total += s;
+        return total / samples.size();
+    }
+
+    // p in [0, 100]; nearest-rank percentile
+    double percentile(double p) const {
+        if (samples.empty()) return 0.0;
+        std::vector<double> sorted(samples);
+        std::sort(sorted.begin(), sorted.end());
+        size_t rank = static_cast<size_t>((p / 100.0) * (sorted.size() - 1) + 0.5);
+        return sorted[std::min(rank, sorted.size() - 1)];
+    }
+
+    double max() const {
+        return samples.empty() ? 0.0 : *std::max_element(samples.begin(), samples.end());
+    }
+};
+
+// Helpers for timing a benchmark and printing a pass/fail report
+namespace BenchReport {
+    inline Uint64 now() {
+        return SDL_GetPerformanceCounter();
+    }
+
+    inline double elapsedMs(Uint64 start, Uint64 end) {
+        return (end - start) * 1000.0 / SDL_GetPerformanceFrequency();
+    }
+
+    // Prints every series and returns true if gate's p95 is within budgetMs
+    inline bool print(std::ostream& out, const std::string& title,
+                      const std::vector<const BenchSeries*>& series,
+                      const BenchSeries& gate, double budgetMs) {
+        // Name column fits the longest name, at least 12 wide
+        int nameWidth = 12;
+        for (const BenchSeries* s : series) {
+            nameWidth = std::max(nameWidth, static_cast<int>(s->name.size()) + 1);
+        }
+
+        out << "==== " << title << " ====" << std::endl;
+        out << std::fixed << std::setprecision(3);
+        out << std::left << std::setw(nameWidth) << "series" << std::right
+            << std::setw(10) << "mean" << std::setw(10) << "p50" << std::setw(10) << "p95"
+            << std::setw(10) << "p99" << std::setw(10) << "max" << "  (ms, "
+            << gate.count() << " frames)" << std::endl;
+
+        for (const BenchSeries* s : series) {
+            out << std::left << std::setw(nameWidth) << s->name << std::right
+                << std::setw(10) << s->mean() << std::setw(10) << s->percentile(50)
+                << std::setw(10) << s->percentile(95) << std::setw(10) << s->percentile(99)
+                << std::setw(10) << s->max() << std::endl;
+        }
+
+        bool passed = gate.count() > 0 && gate.percentile(95) <= budgetMs;
+        out << "Budget: " << gate.name << " p95 <= " << budgetMs << " ms -> "
+            << (passed ? "PASS" : "FAIL") << std::endl;
+        return passed;
+    }
+}
+
+#endif // BENCH_REPORT_H
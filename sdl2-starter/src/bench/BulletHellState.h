@@ -0,0 +1,208 @@
+#ifndef BULLET_HELL_STATE_H
+#define BULLET_HELL_STATE_H
+
+/*********************************************
+Description: Bullet-hell stress scenario. A ring of turtle emitters fires radial and
+             spiral volleys until the level holds at least targetBullets enemy bullets,
+             then times the projectile update, frog collision and drawing for
+             measureFrames frames and prints a pass/fail report against budgetMs.
+             Launch with: ./play --bullet-hell
+             ./play --bullet-hell-check only ramps, without a window, and fails if
+             the ring never holds targetBullets.
+*********************************************/
+
+#include "../GameState.h"
+#include "../frog/frogClass.h"
+#include "../turtle/turtleStruct.h"
+#include "../turtle/turtBullet/EnemyProjectiles.h"
+#include "BenchReport.h"
+#include "../AssetManager.h"
+#include "../render/RenderRecorder.h"
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_image.h>
+#include <vector>
+#include <cmath>
+#include <iostream>
+
+struct BulletHellConfig {
+    int emitters = 24;            // turtles in the ring
+    int targetBullets = 10000;    // live bullets required before timing starts
+    int measureFrames = 300;      // frames timed once the target is reached
+    int maxRampFrames = 1800;     // give up if the target isn't reached by then
+    double budgetMs = 4.0;        // update + collide + draw
+};
+
+class BulletHellState : public GameState {
+private:
+    const int SCREEN_WIDTH = 1280;
+    const int SCREEN_HEIGHT = 720;
+    const float STEP = 1.0f / 60.0f;  // Fixed step so every run is the same script
+
+    BulletHellConfig config;
+    int& exitCode;
+
+    Frog frog;
+    EnemyProjectiles projectiles;
+    std::vector<Turtle> emitters;
+    TextureHandle bulletTexture;
+    TextureHandle turtleTexture;
+
+    BenchSeries updateTimes;
+    BenchSeries collideTimes;
+    BenchSeries drawTimes;
+    BenchSeries totalTimes;
+
+    int frame;
+    bool measuring;
+    bool finished;
+    int hits;
+    int peakBullets;
+    double frameUpdateMs;
+    double frameCollideMs;
+
+    void finish(bool reachedTarget) {
+        finished = true;
+
+        std::cout << "Bullet hell: " << config.emitters << " emitters, peak "
+                  << peakBullets << " live bullets, " << hits << " frog hits" << std::endl;
+        if (!reachedTarget) {
+            std::cout << "Target of " << config.targetBullets << " live bullets not reached in "
+                      << config.maxRampFrames << " frames" << std::endl;
+        }
+
+        bool passed = BenchReport::print(std::cout, "bullet hell stress",
+                                         {&updateTimes, &collideTimes, &drawTimes, &totalTimes},
+                                         totalTimes, config.budgetMs);
+        exitCode = (passed && reachedTarget) ? 0 : 1;
+
+        // Leave the main loop
+        SDL_Event quit;
+        quit.type = SDL_QUIT;
+        SDL_PushEvent(&quit);
+    }
+
+public:
+    BulletHellState(const BulletHellConfig& cfg, int& resultCode)
+        : config(cfg), exitCode(resultCode),
+          frog(1280.0f / 2, 720.0f / 2),
+          projectiles(SCREEN_WIDTH, SCREEN_HEIGHT),
+          updateTimes("update", cfg.measureFrames), collideTimes("collide", cfg.measureFrames),
+          drawTimes("draw", cfg.measureFrames), totalTimes("total", cfg.measureFrames),
+          frame(0), measuring(false), finished(false), hits(0), peakBullets(0),
+          frameUpdateMs(0.0), frameCollideMs(0.0) {}
+
+    void Init() override {
+        projectiles.reserve(config.targetBullets * 2);
+        emitters.reserve(config.emitters);
+
+        // Ring of emitters around the frog, alternating radial and spiral patterns
+        const float radius = 250.0f;
+        for (int i = 0; i < config.emitters; i++) {
+            float angle = (2.0f * M_PI * i) / config.emitters;
+            SDL_Rect r = {
+                static_cast<int>(SCREEN_WIDTH / 2 + std::cos(angle) * radius) - 48,
+                static_cast<int>(SCREEN_HEIGHT / 2 + std::sin(angle) * radius) - 28,
+                32 * 3, 19 * 3
+            };
+            emitters.emplace_back(r, false, 0, 0, nullptr);
+            if (i % 2 == 0) {
+                emitters.back().setFirePattern(FirePattern::RADIAL, 4, 32);
+            } else {
+                emitters.back().setFirePattern(FirePattern::SPIRAL, 1, 8);
+            }
+        }
+    }
+
+    // Run only the ramp, no window or textures; true if config reaches its
+    // own target. At 4 px a frame the defaults level off around 14.5k bullets.
+    static bool rampReachesTarget(const BulletHellConfig& config, int& peak) {
+        int unusedExitCode = 0;
+        BulletHellState state(config, unusedExitCode);
+        state.Init();
+        for (int i = 0; i < config.maxRampFrames && !state.measuring; i++) {
+            state.Update(state.STEP);
+        }
+        peak = state.peakBullets;
+        return state.measuring;
+    }
+
+    void HandleEvents(SDL_Event& event) override {
+        if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_ESCAPE && !finished) {
+            finish(measuring);
+        }
+    }
+
+    void Update(float deltaTime) override {
+        if (finished) return;
+        frame++;
+
+        // Scripted frog: hop left and right to strafe through the pattern
+        if (frame % 45 == 0) {
+            frog.jump((frame / 45) % 2 == 0 ? 1.0f : -1.0f, 0.0f);
+        }
+        frog.update(STEP);
+
+        for (auto& turtle : emitters) {
+            turtle.fireBullet(projectiles, frog);
+        }
+
+        Uint64 start = BenchReport::now();
+        projectiles.update(STEP);
+        Uint64 moved = BenchReport::now();
+        hits += projectiles.collideWith(frog.getCollisionBox());  // The frog can't die here
+        Uint64 collided = BenchReport::now();
+
+        frameUpdateMs = BenchReport::elapsedMs(start, moved);
+        frameCollideMs = BenchReport::elapsedMs(moved, collided);
+        peakBullets = std::max(peakBullets, projectiles.size());
+
+        if (!measuring && projectiles.size() >= config.targetBullets) {
+            measuring = true;
+        }
+    }
+
+    void Render(SDL_Renderer* renderer) override {
+        if (!bulletTexture) {
+            AssetManager* assets = AssetManager::getInstance();
+            bulletTexture = assets->getTexture(renderer, "assets/bulletNew.png");
+            turtleTexture = assets->getTexture(renderer, "assets/turtle.png");
+        }
+
+        SDL_SetRenderDrawColor(renderer, 20, 40, 40, 255);
+        Draw::clear(renderer);
+
+        for (const auto& turtle : emitters) {
+            Draw::copy(renderer, turtleTexture.get(), nullptr, &turtle.rect);
+        }
+
+        SDL_Rect frogBox = frog.getCollisionBox();
+        SDL_SetRenderDrawColor(renderer, 111, 210, 144, 255);
+        Draw::fillRect(renderer, &frogBox);
+
+        Uint64 start = BenchReport::now();
+        projectiles.render(renderer, bulletTexture.get());
+        double drawMs = BenchReport::elapsedMs(start, BenchReport::now());
+
+        if (finished) return;
+
+        if (measuring) {
+            updateTimes.add(frameUpdateMs);
+            collideTimes.add(frameCollideMs);
+            drawTimes.add(drawMs);
+            totalTimes.add(frameUpdateMs + frameCollideMs + drawMs);
+
+            if (static_cast<int>(totalTimes.count()) >= config.measureFrames) {
+                finish(true);
+            }
+        } else if (frame >= config.maxRampFrames) {
+            finish(false);
+        }
+    }
+
+    void CleanUp() override {
+        bulletTexture.reset();
+        turtleTexture.reset();
+    }
+};
+
+#endif // BULLET_HELL_STATE_H
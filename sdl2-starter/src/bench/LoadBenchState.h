@@ -0,0 +1,131 @@
+#ifndef LOAD_BENCH_STATE_H
+#define LOAD_BENCH_STATE_H
+
+/*********************************************
+Description: Asset load benchmark. Loads every image in assets.pack `rounds` times
+             the old way (PNG through SDL_image) and the fast way (the .rgba variant
+             made by tools/torgba.cpp) and times the decode and the texture upload
+             for the whole set. Passes if the fast path's p95 beats the PNG median.
+             Launch with: ./play --load-bench --rounds 20
+*********************************************/
+
+#include "../GameState.h"
+#include "../AssetPack.h"
+#include "../ImageLoader.h"
+#include "BenchReport.h"
+#include <SDL2/SDL.h>
+#include <string>
+#include <vector>
+#include <iostream>
+
+struct LoadBenchConfig {
+    int rounds = 20;  // full passes over the asset set, per format
+};
+
+class LoadBenchState : public GameState {
+private:
+    LoadBenchConfig config;
+    int& exitCode;
+
+    std::vector<std::string> images;  // the PNGs in the pack
+    int fastImages;                   // how many of those have a .rgba variant
+
+    BenchSeries pngDecode;
+    BenchSeries pngUpload;
+    BenchSeries pngTotal;
+    BenchSeries fastDecode;
+    BenchSeries fastUpload;
+    BenchSeries fastTotal;
+
+    bool finished;
+
+    // Load the whole set once, adding this round's times to the series
+    void loadAll(SDL_Renderer* renderer, bool fast, BenchSeries& decode, BenchSeries& upload,
+                 BenchSeries& total) {
+        ImageLoader::setPreferFast(fast);
+        double decodeMs = 0.0;
+        double uploadMs = 0.0;
+        int hits = 0;
+
+        for (const std::string& path : images) {
+            Uint64 start = BenchReport::now();
+            bool usedFast = false;
+            SDL_Surface* surface = ImageLoader::load(path, &usedFast);
+            Uint64 decoded = BenchReport::now();
+            SDL_Texture* texture = surface ? SDL_CreateTextureFromSurface(renderer, surface) : nullptr;
+            Uint64 uploaded = BenchReport::now();
+
+            decodeMs += BenchReport::elapsedMs(start, decoded);
+            uploadMs += BenchReport::elapsedMs(decoded, uploaded);
+            if (usedFast) hits++;
+
+            if (texture) SDL_DestroyTexture(texture);
+            if (surface) SDL_FreeSurface(surface);
+        }
+
+        decode.add(decodeMs);
+        upload.add(uploadMs);
+        total.add(decodeMs + uploadMs);
+        if (fast) fastImages = hits;
+    }
+
+    void finish(bool passed) {
+        finished = true;
+        exitCode = passed ? 0 : 1;
+
+        // Leave the main loop
+        SDL_Event quit;
+        quit.type = SDL_QUIT;
+        SDL_PushEvent(&quit);
+    }
+
+public:
+    LoadBenchState(const LoadBenchConfig& cfg, int& resultCode)
+        : config(cfg), exitCode(resultCode), fastImages(0),
+          pngDecode("png decode", cfg.rounds), pngUpload("png upload", cfg.rounds),
+          pngTotal("png total", cfg.rounds), fastDecode("rgba decode", cfg.rounds),
+          fastUpload("rgba upload", cfg.rounds), fastTotal("rgba total", cfg.rounds),
+          finished(false) {}
+
+    void Init() override {
+        for (const std::string& name : AssetPack::getInstance()->getNames()) {
+            if (name.size() > 4 && name.compare(name.size() - 4, 4, ".png") == 0) {
+                images.push_back(name);
+            }
+        }
+    }
+
+    void HandleEvents(SDL_Event& event) override {}
+
+    void Update(float deltaTime) override {}
+
+    void Render(SDL_Renderer* renderer) override {
+        if (finished) return;
+
+        if (images.empty()) {
+            std::cout << "Load bench: no images, build assets.pack first (make)" << std::endl;
+            finish(false);
+            return;
+        }
+
+        // Everything in one frame; the formats take turns so caches warm evenly
+        bool preferFast = ImageLoader::getPreferFast();
+        for (int round = 0; round < config.rounds; round++) {
+            loadAll(renderer, false, pngDecode, pngUpload, pngTotal);
+            loadAll(renderer, true, fastDecode, fastUpload, fastTotal);
+        }
+        ImageLoader::setPreferFast(preferFast);
+
+        std::cout << "Load bench: " << images.size() << " images, " << fastImages
+                  << " with a .rgba variant, " << config.rounds << " rounds" << std::endl;
+        bool passed = BenchReport::print(std::cout, "asset load (ms per full set)",
+                                         {&pngDecode, &pngUpload, &pngTotal,
+                                          &fastDecode, &fastUpload, &fastTotal},
+                                         fastTotal, pngTotal.percentile(50));
+        finish(passed);
+    }
+
+    void CleanUp() override {}
+};
+
+#endif // LOAD_BENCH_STATE_H
@@ -0,0 +1,291 @@
+#ifndef SCENARIO_STATE_H
+#define SCENARIO_STATE_H
+
+/*********************************************
+Description: Scenario run. Starts a real gameplay match with the entity counts from
+             the command line already in place (wasps, turtles, enemy bullets, rain),
+             drives the frog with a fixed input script (strafe jumps, shots, grapples)
+             on a fixed 60 Hz step and seed, and records frame, update and render
+             times plus every PROFILE_SCOPE section of gameplay, with each section's
+             heap allocations per frame. Prints the tables and writes the same numbers
+             to JSON. Passes if frame p95 fits in budgetMs. With --assert-no-alloc any
+             allocation inside a profiled section after the warmup fails the run.
+             Launch with: ./play --wasps 2000 --turtles 200 --bullets 5000 --rain 5000
+                                 --frames 3000 --seed 42 [--headless] [--json out.json]
+*********************************************/
+
+#include "../GameState.h"
+#include "../gameplay.h"
+#include "../Profiler.h"
+#include "../AllocTracker.h"
+#include "BenchReport.h"
+#include "ScriptedPilot.h"
+#include <SDL2/SDL.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+struct ScenarioConfig {
+    int wasps = 200;
+    int turtles = 20;
+    int bullets = 500;      // enemy bullets, topped back up every frame
+    int rain = 2000;        // drops on screen
+    int frames = 1800;      // measured frames, after the warmup
+    int warmupFrames = 60;
+    uint32_t seed = 42;
+    bool headless = false;  // SDL's dummy video driver and a software renderer (set up in main)
+    bool steadyAllocCheck = false;  // no allocations in profiled sections once warmed up
+    int spriteCache = -1;   // GameOptions::spriteCache, to compare the render path with and without
+    std::string jsonPath = "scenario.json";
+    double budgetMs = 1000.0 / 60.0;  // whole frame
+};
+
+class ScenarioState : public GameState {
+private:
+    const int SCREEN_WIDTH = 1280;
+    const int SCREEN_HEIGHT = 720;
+    const float STEP = 1.0f / 60.0f;  // Fixed step so every run is the same script
+
+    ScenarioConfig config;
+    int& exitCode;
+
+    std::unique_ptr<gameplay> game;
+    std::mt19937 rng;
+
+    BenchSeries frameTimes;   // wall time from one Update to the next, present included
+    BenchSeries updateTimes;
+    BenchSeries renderTimes;
+
+    int frame;
+    bool populated;
+    bool finished;
+    Uint64 lastUpdateStart;
+    double frameUpdateMs;
+
+    bool measuring() const { return frame > config.warmupFrames; }
+
+    // Everything the command line asked for, placed before the first timed frame
+    void populate() {
+        World& world = *game->getWorld();
+        std::uniform_int_distribution<int> waspX(0, SCREEN_WIDTH - 16 * 3);
+        std::uniform_int_distribution<int> waspY(0, SCREEN_HEIGHT - 16 * 3);
+        for (int i = 0; i < config.wasps; i++) {
+            world.spawnWaspAt(waspX(rng), waspY(rng));
+        }
+
+        std::uniform_int_distribution<int> turtleX(0, SCREEN_WIDTH - 32 * 3);
+        std::uniform_int_distribution<int> turtleY(0, SCREEN_HEIGHT - 19 * 3);
+        for (int i = 0; i < config.turtles; i++) {
+            world.spawnTurtleAt(turtleX(rng), turtleY(rng));
+        }
+
+        // Room for the topped-up bullets plus the turtles' own, so the vector
+        // doesn't grow in a measured frame
+        world.getEnemyProjectiles().reserve(config.bullets * 2 + 256);
+        populated = true;
+    }
+
+    // Replace bullets that left the screen or hit the frog
+    void topUpBullets() {
+        std::uniform_real_distribution<float> xDist(0.0f, static_cast<float>(SCREEN_WIDTH));
+        std::uniform_real_distribution<float> yDist(0.0f, static_cast<float>(SCREEN_HEIGHT));
+        std::uniform_real_distribution<float> angleDist(0.0f, 2.0f * static_cast<float>(M_PI));
+        std::uniform_real_distribution<float> speedDist(60.0f, 240.0f);
+
+        World& world = *game->getWorld();
+
+        for (int i = world.getEnemyBulletCount(); i < config.bullets; i++) {
+            float angle = angleDist(rng);
+            float speed = speedDist(rng);
+            world.spawnEnemyBullet(xDist(rng), yDist(rng), std::cos(angle) * speed, std::sin(angle) * speed);
+        }
+    }
+
+    static void writeStats(std::ostream& out, const BenchSeries& series) {
+        out << "{\"mean\": " << series.mean() << ", \"p50\": " << series.percentile(50)
+            << ", \"p95\": " << series.percentile(95) << ", \"p99\": " << series.percentile(99)
+            << ", \"max\": " << series.max() << ", \"samples\": " << series.count() << "}";
+    }
+
+    bool writeJson(bool passed) const {
+        std::ofstream out(config.jsonPath);
+        if (!out) return false;
+        out.setf(std::ios::fixed);
+        out.precision(4);
+
+        out << "{\n";
+        out << "  \"scenario\": {\"wasps\": " << config.wasps << ", \"turtles\": " << config.turtles
+            << ", \"bullets\": " << config.bullets << ", \"rain\": " << config.rain
+            << ", \"frames\": " << config.frames << ", \"warmup_frames\": " << config.warmupFrames
+            << ", \"seed\": " << config.seed << ", \"headless\": " << (config.headless ? "true" : "false")
+            << "},\n";
+        out << "  \"budget_ms\": " << config.budgetMs << ",\n";
+        out << "  \"passed\": " << (passed ? "true" : "false") << ",\n";
+        out << "  \"final_counts\": {\"wasps\": " << game->getWaspCount() << ", \"turtles\": "
+            << game->getTurtleCount() << ", \"bullets\": " << game->getEnemyBulletCount()
+            << ", \"rain\": " << game->getRainCount() << "},\n";
+
+        out << "  \"frame_ms\": {\n";
+        out << "    \"frame\": ";
+        writeStats(out, frameTimes);
+        out << ",\n    \"update\": ";
+        writeStats(out, updateTimes);
+        out << ",\n    \"render\": ";
+        writeStats(out, renderTimes);
+        out << "\n  },\n";
+
+        // Profiled sections in the order gameplay first hit them
+        Profiler* profiler = Profiler::getInstance();
+        out << "  \"subsystems_ms\": {";
+        for (int i = 0; i < profiler->getScopeCount(); i++) {
+            const BenchSeries& series = profiler->getSeries(i);
+            out << (i == 0 ? "\n" : ",\n") << "    \"" << series.name << "\": ";
+            writeStats(out, series);
+        }
+        out << "\n  },\n";
+
+        // Heap allocations per frame for each tag that allocated at all
+        out << "  \"allocations\": {\"tracking\": " << (AllocTracker::isEnabled() ? "true" : "false")
+            << ", \"frames\": " << AllocTracker::getFrameCount() << ", \"per_tag\": {";
+        double perFrame = AllocTracker::getFrameCount() > 0 ? 1.0 / AllocTracker::getFrameCount() : 0.0;
+        bool first = true;
+        for (int tag = 0; tag < AllocTracker::getTagCount(); tag++) {
+            const AllocTracker::TagStats& stats = AllocTracker::getStats(tag);
+            if (stats.allocs == 0) continue;
+            out << (first ? "\n" : ",\n") << "    \"" << AllocTracker::getTagName(tag) << "\": {"
+                << "\"allocs_per_frame\": " << stats.allocs * perFrame
+                << ", \"bytes_per_frame\": " << stats.bytes * perFrame
+                << ", \"max_frame_allocs\": " << stats.maxFrameAllocs
+                << ", \"max_frame_bytes\": " << stats.maxFrameBytes
+                << ", \"frames_allocating\": " << stats.framesAllocating << "}";
+            first = false;
+        }
+        out << "\n  }, \"frees_per_frame\": " << AllocTracker::getFrees() * perFrame
+            << ", \"max_frame_frees\": " << AllocTracker::getMaxFrameFrees() << "}\n";
+        out << "}\n";
+        return static_cast<bool>(out);
+    }
+
+    void finish() {
+        finished = true;
+        Profiler* profiler = Profiler::getInstance();
+        profiler->setEnabled(false);
+        AllocTracker::setSteadyState(false);
+
+        std::cout << "Scenario: " << config.wasps << " wasps, " << config.turtles << " turtles, "
+                  << config.bullets << " bullets, " << config.rain << " drops, seed " << config.seed
+                  << std::endl;
+
+        std::vector<const BenchSeries*> series = {&frameTimes, &updateTimes, &renderTimes};
+        for (int i = 0; i < profiler->getScopeCount(); i++) {
+            series.push_back(&profiler->getSeries(i));
+        }
+        bool passed = BenchReport::print(std::cout, "scenario", series, frameTimes, config.budgetMs);
+        AllocTracker::printReport(std::cout);
+        exitCode = passed ? 0 : 1;
+
+        if (writeJson(passed)) {
+            std::cout << "Wrote " << config.jsonPath << std::endl;
+        } else {
+            std::cout << "Couldn't write " << config.jsonPath << std::endl;
+            exitCode = 1;
+        }
+
+        // Leave the main loop
+        SDL_Event quit;
+        quit.type = SDL_QUIT;
+        SDL_PushEvent(&quit);
+    }
+
+public:
+    ScenarioState(GameStateManager& manager, const ScenarioConfig& cfg, int& resultCode)
+        : config(cfg), exitCode(resultCode), game(new gameplay(manager)), rng(cfg.seed),
+          frameTimes("frame", cfg.frames), updateTimes("update", cfg.frames),
+          renderTimes("render", cfg.frames), frame(0), populated(false), finished(false),
+          lastUpdateStart(0), frameUpdateMs(0.0) {}
+
+    void Init() override {
+        GameOptions options;
+        options.seed = config.seed;
+        options.maxWasps = config.wasps;
+        options.maxTurtles = config.turtles;
+        options.rainDrops = config.rain;
+        options.invulnerable = true;  // A dead frog would stop the script
+        options.pipelined = false;    // The script and populate() change the world between ticks
+        options.spriteCache = config.spriteCache;
+        game->setOptions(options);
+        game->Init();
+
+        Profiler::getInstance()->setEnabled(true);
+    }
+
+    void HandleEvents(SDL_Event& event) override {
+        // The script is the only input; Escape ends the run early with what was measured
+        if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_ESCAPE && !finished) {
+            finish();
+        }
+    }
+
+    void Update(float deltaTime) override {
+        if (finished || !game->isLoaded()) return;  // The first Render loads the textures
+        if (!populated) populate();
+
+        // The main loop has closed the last measured frame's profile by now
+        if (static_cast<int>(updateTimes.count()) >= config.frames) {
+            finish();
+            return;
+        }
+
+        // Only the measured frames count, for timings and allocations alike
+        if (frame == config.warmupFrames) {
+            Profiler::getInstance()->reset();
+            AllocTracker::reset();
+            AllocTracker::setSteadyState(config.steadyAllocCheck);
+        }
+
+        Uint64 start = BenchReport::now();
+        if (lastUpdateStart != 0 && frame > config.warmupFrames + 1) {
+            frameTimes.add(BenchReport::elapsedMs(lastUpdateStart, start));
+        }
+        lastUpdateStart = start;
+        frame++;
+
+        ScriptedPilot::step(*game->getWorld(), frame);
+        topUpBullets();
+        game->Update(STEP);
+        frameUpdateMs = BenchReport::elapsedMs(start, BenchReport::now());
+    }
+
+    void Render(SDL_Renderer* renderer) override {
+        if (finished) return;
+
+        Uint64 start = BenchReport::now();
+        game->Render(renderer);
+        double renderMs = BenchReport::elapsedMs(start, BenchReport::now());
+
+        // The main loop turns the profiled sections into one sample each per frame
+        if (measuring()) {
+            updateTimes.add(frameUpdateMs);
+            renderTimes.add(renderMs);
+        }
+    }
+
+    void RenderHUD(SDL_Renderer* renderer) override {
+        if (finished) return;
+        game->RenderHUD(renderer);
+    }
+
+    void CleanUp() override {
+        Profiler::getInstance()->setEnabled(false);
+        AllocTracker::setSteadyState(false);
+        game->CleanUp();
+    }
+};
+
+#endif // SCENARIO_STATE_H
@@ -0,0 +1,38 @@
+#ifndef SCRIPTED_PILOT_H
+#define SCRIPTED_PILOT_H
+
+#include "../World.h"
+#include <SDL2/SDL.h>
+#include <cmath>
+
+// The frog's input for a frame of a scripted run: strafe jumps, a steady
+// stream of shots sweeping round the frog, and a grapple to a point circling
+// the screen. Scenario runs and batch runs fly the same script, so a world
+// given the same seed plays out the same either way.
+struct ScriptedPilot {
+    static void step(World& world, int frame) {
+        if (frame % 45 == 0) {
+            int side = (frame / 45) % 2 == 0 ? 1 : -1;
+            int vertical = (frame / 90) % 3 - 1;
+            world.jumpFrog(side, vertical);
+        }
+
+        if (frame % 12 == 0) {
+            SDL_Rect frogBox = world.getFrogBox();
+            float aim = frame * 0.05f;
+            world.shootAt(frogBox.x + frogBox.w / 2 + static_cast<int>(std::cos(aim) * 200.0f),
+                          frogBox.y + frogBox.h / 2 + static_cast<int>(std::sin(aim) * 200.0f));
+        }
+        if (frame % 150 == 140) {
+            world.reloadGun();
+        }
+
+        if (frame % 120 == 60) {
+            float around = frame * 0.01f;
+            world.grappleFrog(World::WIDTH / 2 + static_cast<int>(std::cos(around) * 400.0f),
+                              World::HEIGHT / 2 + static_cast<int>(std::sin(around) * 220.0f));
+        }
+    }
+};
+
+#endif // SCRIPTED_PILOT_H
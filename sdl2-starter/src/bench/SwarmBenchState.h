@@ -0,0 +1,137 @@
+#ifndef SWARM_BENCH_STATE_H
+#define SWARM_BENCH_STATE_H
+
+/*********************************************
+Description: Swarm benchmark. Scatters `wasps` boids over the screen and has them
+             chase a target circling the middle, then times WaspSwarm::update and the
+             batched wasp drawing for measureFrames frames after a short warmup and
+             prints a pass/fail report against budgetMs (swarm update only).
+             Launch with: ./play --swarm-bench --wasps 5000
+*********************************************/
+
+#include "../GameState.h"
+#include "../wasp/WaspSwarm.h"
+#include "../render/QuadBatch.h"
+#include "../render/RenderRecorder.h"
+#include "BenchReport.h"
+#include "../AssetManager.h"
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_image.h>
+#include <random>
+#include <cmath>
+#include <iostream>
+
+struct SwarmBenchConfig {
+    int wasps = 5000;
+    int warmupFrames = 60;        // let the flock form before timing
+    int measureFrames = 300;
+    double budgetMs = 5.0;        // swarm update
+};
+
+class SwarmBenchState : public GameState {
+private:
+    const int SCREEN_WIDTH = 1280;
+    const int SCREEN_HEIGHT = 720;
+    const float STEP = 1.0f / 60.0f;  // Fixed step so every run is the same script
+    const float WASP_SIZE = 16 * 3;
+
+    SwarmBenchConfig config;
+    int& exitCode;
+
+    WaspSwarm swarm;
+    QuadBatch batch;
+    TextureHandle waspTexture;
+
+    BenchSeries updateTimes;
+    BenchSeries drawTimes;
+
+    int frame;
+    bool finished;
+    double frameUpdateMs;
+
+    void finish() {
+        finished = true;
+        std::cout << "Swarm bench: " << swarm.size() << " wasps" << std::endl;
+
+        bool passed = BenchReport::print(std::cout, "wasp swarm",
+                                         {&updateTimes, &drawTimes},
+                                         updateTimes, config.budgetMs);
+        exitCode = passed ? 0 : 1;
+
+        // Leave the main loop
+        SDL_Event quit;
+        quit.type = SDL_QUIT;
+        SDL_PushEvent(&quit);
+    }
+
+public:
+    SwarmBenchState(const SwarmBenchConfig& cfg, int& resultCode)
+        : config(cfg), exitCode(resultCode),
+          swarm(cfg.wasps, 1280, 720), batch(2048),
+          updateTimes("swarm update", cfg.measureFrames), drawTimes("draw", cfg.measureFrames),
+          frame(0), finished(false), frameUpdateMs(0.0) {}
+
+    void Init() override {
+        // Same seed every run so results are comparable
+        std::mt19937 rng(1234);
+        std::uniform_real_distribution<float> xDist(0.0f, static_cast<float>(SCREEN_WIDTH));
+        std::uniform_real_distribution<float> yDist(0.0f, static_cast<float>(SCREEN_HEIGHT));
+        std::uniform_real_distribution<float> vDist(-60.0f, 60.0f);
+        for (int i = 0; i < config.wasps; i++) {
+            swarm.add(xDist(rng), yDist(rng), vDist(rng), vDist(rng));
+        }
+    }
+
+    void HandleEvents(SDL_Event& event) override {
+        if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_ESCAPE && !finished) {
+            finish();
+        }
+    }
+
+    void Update(float deltaTime) override {
+        if (finished) return;
+        frame++;
+
+        // Target circles the middle of the screen like a hopping frog
+        float t = frame * STEP;
+        float targetX = SCREEN_WIDTH / 2 + std::cos(t * 0.8f) * 300.0f;
+        float targetY = SCREEN_HEIGHT / 2 + std::sin(t * 0.8f) * 200.0f;
+
+        Uint64 start = BenchReport::now();
+        swarm.update(STEP, targetX, targetY);
+        frameUpdateMs = BenchReport::elapsedMs(start, BenchReport::now());
+    }
+
+    void Render(SDL_Renderer* renderer) override {
+        if (!waspTexture) {
+            waspTexture = AssetManager::getInstance()->getTexture(renderer, "assets/wasp.png");
+        }
+
+        SDL_SetRenderDrawColor(renderer, 20, 40, 40, 255);
+        Draw::clear(renderer);
+
+        Uint64 start = BenchReport::now();
+        const SDL_Color white = {255, 255, 255, 255};
+        batch.begin(renderer, waspTexture.get());
+        for (int i = 0; i < swarm.size(); i++) {
+            batch.addRect(swarm.getX(i) - WASP_SIZE / 2, swarm.getY(i) - WASP_SIZE / 2,
+                          WASP_SIZE, WASP_SIZE, white);
+        }
+        batch.end();
+        double drawMs = BenchReport::elapsedMs(start, BenchReport::now());
+
+        if (finished || frame <= config.warmupFrames) return;
+
+        updateTimes.add(frameUpdateMs);
+        drawTimes.add(drawMs);
+        if (static_cast<int>(updateTimes.count()) >= config.measureFrames) {
+            finish();
+        }
+    }
+
+    void CleanUp() override {
+        waspTexture.reset();
+    }
+};
+
+#endif // SWARM_BENCH_STATE_H
@@ -11,11 +11,8 @@ Frog::Frog(float startX, float startY)
 
 // Destructor
 Frog::~Frog() {
-    for (auto& pair : animations) {
-        if (pair.second.spritesheet) {
-            SDL_DestroyTexture(pair.second.spritesheet);
-        }
-    }
+    // Spritesheets belong to whoever registered them (several animations can
+    // share one sheet), so they are not destroyed here
 }
 
 // Health functions
@@ -45,6 +42,13 @@ void Frog::drawHealthBar() {
     }
 }
 
+bool Frog::copyHealthBar(healthBar& out) const {
+    if (!hpBar) return false;
+    out = *hpBar;
+    out.setPosition(x + collisionBox.w/2, y);
+    return true;
+}
+
 // Add animation
 void Frog::addAnimation(State state, SDL_Texture* spritesheet, int frameWidth, 
                      int frameHeight, int frameCount, float frameTime) {
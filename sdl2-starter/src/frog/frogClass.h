@@ -55,6 +55,9 @@ public:
     void takeDamage(int amount);
     bool isAlive() const { return health > 0; }
     void drawHealthBar();
+    // The health bar as drawHealthBar would place it, for drawing from a snapshot;
+    // false before initializeHealthBar
+    bool copyHealthBar(healthBar& out) const;
 
     // Getters
     SDL_Rect getCurrentFrame() const;
@@ -21,6 +21,25 @@ Memory & Health Bar Fixes (2024):
 10. Added safety checks for renderer availability in Update and Render methods
 
 - added hurtFlash header and implementation files to show damage
+- added swarm mode: wasps flock through WaspSwarm when GameOptions::swarmMode is set
+- turtles path toward the frog through a shared FlowField over the terrain
+- enemy decisions are time-sliced by AIScheduler with distance-based update rates
+- SpawnDirector replaces frame-count spawning with timed waves and per-type budgets
+- wasps and turtles live in EntityPools sized at Init; dead enemies are recycled in place
+- textures come from the AssetManager cache, so a new game reuses what the last one loaded
+- prefetchTextures() lets the menu decode the match's textures in the background
+- fonts are read from the memory-mapped assets.pack when there is one
+- messages go through the async Logger instead of std::cout
+- PROFILE_SCOPE timings per subsystem, and hooks that let bench/ScenarioState.h drive a match
+- frog, flash and shotgun steps are traced too, with entity counts as trace counters (Tracer.h)
+- entity counts also go to the FlightRecorder each frame, for hitch dumps
+- and to the MetricsPublisher, with pellets, water rings and trail particles added
+- the simulation lives in a World (World.h); gameplay loads assets, handles input and draws it
+- the next tick is simulated on a SimulationThread while this one is drawn from a WorldSnapshot
+- flipped and rotated sprites come from a SpriteCache on the software renderer
+- the game over screen is drawn in RenderHUD, so it stays sharp when the scene is rendered low-res
+- terrain and terrain elements are drawn from one BackgroundLayer texture, rebaked when either changes
+- hurt flashes draw from FlashTints made while loading instead of a new texture each frame
 *********************************************/
 
 #ifndef GAMEPLAY_H
@@ -28,21 +47,27 @@ Memory & Health Bar Fixes (2024):
 
 #include "GameState.h"
 #include "GameStateManager.h"  // Include full header instead of forward declaration
-#include "frog/frogClass.h"
-#include "turtle/turtleStruct.h"
-#include "wasp/waspStruct.h"
-#include "guns/DefaultShotgun.h"
-#include "terrain/TerrainGrid.h"
-#include "terrainElem.h"
-#include "RainSystem.h"
-#include "waterPhysics.h"
+#include "World.h"
+#include "WorldSnapshot.h"
+#include "SimulationThread.h"
 #include "hurtFlash.h"
+#include "terrainElem.h"
+#include "GameOptions.h"
+#include "AssetManager.h"
+#include "AssetPack.h"
+#include "Logger.h"
+#include "Profiler.h"
+#include "Tracer.h"
+#include "FlightRecorder.h"
+#include "MetricsPublisher.h"
+#include "render/RenderRecorder.h"
+#include "render/SpriteCache.h"
+#include "render/BackgroundLayer.h"
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_ttf.h>
 #include <cmath>
 #include <vector>
 #include <string>
-#include <iostream>
 #include <memory>
 
 extern "C" {
@@ -50,11 +75,18 @@ extern "C" {
     const char* IMG_GetError(void);
 }
 
+// Textures loaded in gameplay::Render; the menu prefetches them while it's up
+static const char* const FROG_TEXTURE = "assets/frog.png";
+static const char* const TONGUE_TIP_TEXTURE = "assets/tongue_tip.png";
+static const char* const WASP_TEXTURE = "assets/wasp.png";
+static const char* const TURTLE_TEXTURE = "assets/turtle.png";
+static const char* const SHELL_TEXTURE = "assets/shell.png";
+static const char* const BULLET_TEXTURE = "assets/bulletNew.png";
+
 class gameplay : public GameState {
 private:
     const int SCREEN_WIDTH = 1280;
     const int SCREEN_HEIGHT = 720;
-    SDL_Renderer* currentRenderer;
     GameStateManager& stateManager;
 
     // Font members for game over text
@@ -63,21 +95,8 @@ private:
     SDL_Color whiteColor;
     SDL_Color brownColor;
 
-    // Damage constants
-    const int WASP_DAMAGE = 10;
-    const int BULLET_DAMAGE = 30;
-    const int FROG_MAX_HEALTH = 100;
-
-    // How many enemies are spawned at a time
-    const int numTurtlesSpawned = 1;
-    const int numWaspsSpawned = 3;
-
-    // Add hurtFlash instance
-    hurtFlash* flashManager;
-
-    Frog frog;
-    SDL_Texture* spritesheet;
-    SDL_Texture* tongueTip;  // Added for tongue rendering
+    TextureHandle spritesheet;
+    TextureHandle tongueTip;  // Added for tongue rendering
     // Define frog states as constants
     const Frog::State frogIdle = Frog::State::IDLE;
     const Frog::State frogGrappling = Frog::State::GRAPPLING;
@@ -86,29 +105,51 @@ private:
     const Frog::State frogDead = Frog::State::DEAD;
 
     // Wasp and Turtle textures
-    SDL_Texture* turtleTexture;
-    SDL_Texture* shellTexture;  // Added separate texture for shell
-    SDL_Texture* bulletTexture;
-    SDL_Texture* waspTexture;
-
-    // Member vectors to hold active wasps and turtles
-    std::vector<Wasp> wasps;
-    std::vector<Turtle> turtles;
-    std::vector<Bullet> bullets;
-
-    std::shared_ptr<TerrainGrid> terrain;
+    TextureHandle turtleTexture;
+    TextureHandle shellTexture;  // Added separate texture for shell
+    TextureHandle bulletTexture;
+    TextureHandle waspTexture;
+
+    // Baked flips for the frog and enemies, rotations for the gun; null when the
+    // renderer does RenderCopyEx well enough (options.spriteCache)
+    std::unique_ptr<SpriteCache> spriteCache;
+    std::unique_ptr<SpriteCache> gunSprites;
+    const int GUN_SPRITE_ANGLES = 64;
+
+    // Red-tinted copies of the frog and enemies for hurt flashes, made while loading
+    std::unique_ptr<FlashTints> flashTints;
+
+    GameOptions options;
+    std::shared_ptr<TerrainGrid> terrain;  // The menu's map, handed to the world
     std::shared_ptr<terrainElements> terrainElems;
-    std::unique_ptr<RainSystem> rainSystem;
-    std::unique_ptr<WaterPhysics> waterPhysics;  // Added water physics system
+    std::unique_ptr<BackgroundLayer> background;  // terrain and its elements, baked into one texture
+
+    // Everything that simulates; built by the first Render, once there's a renderer
+    std::unique_ptr<World> world;
+    std::unique_ptr<WorldSnapshot> snapshot;        // What Render draws: the last finished tick
+    std::unique_ptr<SimulationThread> simulation;   // null when options.pipelined is off
 
-    DefaultShotgun* shotgun;
+    // Frog input from HandleEvents. The world may be mid-tick when it arrives, so
+    // it's applied in Update between ticks.
+    struct FrogInput {
+        enum Type { JUMP, GRAPPLE, SHOOT, RELOAD, STOP } type;
+        int x, y;
+    };
+    std::vector<FrogInput> pendingInput;
 
     TTF_Font* loadFont(const char* filename, int size) {
+        // The pack, if any, then the loose files
+        SDL_RWops* packed = AssetPack::getInstance()->openRW(std::string("fonts/") + filename);
+        if (packed) {
+            TTF_Font* font = TTF_OpenFontRW(packed, 1, size);
+            if (font) return font;
+        }
+
         TTF_Font* font = TTF_OpenFont((std::string("build/debug/fonts/") + filename).c_str(), size);
         if (!font) {
             font = TTF_OpenFont((std::string("fonts/") + filename).c_str(), size);
             if (!font) {
-                std::cout << "Failed to load font " << filename << ": " << TTF_GetError() << std::endl;
+                LOG_ERROR("Failed to load font %s: %s", filename, TTF_GetError());
             }
         }
         return font;
@@ -146,10 +187,10 @@ private:
         }
 
         SDL_Rect destRect = {x - width/2, y, width, height};
-        SDL_RenderCopy(renderer, outlineTexture, NULL, &destRect);
+        Draw::copy(renderer, outlineTexture, NULL, &destRect);
 
         SDL_Rect regularRect = {x - width/2, y + 1, width - 1, height};
-        SDL_RenderCopy(renderer, regularTexture, NULL, &regularRect);
+        Draw::copy(renderer, regularTexture, NULL, &regularRect);
 
         SDL_FreeSurface(outlineSurface);
         SDL_FreeSurface(regularSurface);
@@ -157,138 +198,89 @@ private:
         SDL_DestroyTexture(regularTexture);
     }
 
-    // Fisher's method for loading textures
-    SDL_Texture* loadTexture(const std::string& path, SDL_Renderer* renderer) {
-        SDL_Texture* newTexture = IMG_LoadTexture(renderer, path.c_str());
-        if (newTexture == nullptr) {
-            std::cerr << "Failed to load texture: " << IMG_GetError() << std::endl;
-        }
-        return newTexture;
+    // Fisher's method for loading textures (now served from the shared cache)
+    TextureHandle loadTexture(const std::string& path, SDL_Renderer* renderer) {
+        return AssetManager::getInstance()->getTexture(renderer, path);
     }
 
-    void checkBulletCollisions(SDL_Renderer* renderer) {
-        auto& shotgunBullets = shotgun->getBullets();
-        
-        // Check wasp collisions
-        for (auto& wasp : wasps) {
-            if (!wasp.active) continue;
-            
-            SDL_Rect waspBox = wasp.rect;
-            for (const auto& [id, bullet] : shotgunBullets) {
-                if (SDL_HasIntersection(&bullet.bulletPos, &waspBox)) {
-                    wasp.takeDamage(bullet.bulletDamage);
-                    flashManager->startFlash(&wasp); // Start flash effect
-                    break;
-                }
-            }
-        }
-        
-        // Check turtle collisions
-        for (auto& turtle : turtles) {
-            if (turtle.hiding) continue;
-            
-            SDL_Rect turtleBox = turtle.rect;
-            for (const auto& [id, bullet] : shotgunBullets) {
-                if (SDL_HasIntersection(&bullet.bulletPos, &turtleBox)) {
-                    turtle.takeDamage(bullet.bulletDamage);
-                    flashManager->startFlash(&turtle); // Start flash effect
-                    break;
-                }
-            }
+    // Names are literals; the recorder and tracer keep the pointer
+    void recordCount(const char* name, double value) {
+        FlightRecorder::getInstance()->setCounter(name, value);
+        MetricsPublisher::getInstance()->setCounter(name, value);
+        if (Tracer::isRecording()) {
+            Tracer::getInstance()->counter(name, value);
         }
     }
 
-    void checkEnemyCollisions() {
-        SDL_Rect frogBox = frog.getCollisionBox();
-
-        // Check wasp collisions
-        for (auto& wasp : wasps) {
-            if (!wasp.active || wasp.pendingRemoval) continue;
-            
-            if (SDL_HasIntersection(&wasp.rect, &frogBox) && wasp.canDealDamage()
-                && frog.getState() != Frog::State::JUMPING) {
-                frog.takeDamage(WASP_DAMAGE);
-                flashManager->startFlash(&frog); // Start flash effect
-                wasp.resetDamageTimer();
-            }
+    // A flipped sprite, from the cache when there is one. Flashing sprites are
+    // drawn directly, so the cache doesn't bake every tint level.
+    void drawSprite(SDL_Renderer* renderer, SDL_Texture* texture, bool flashing, const SDL_Rect* src,
+                    const SDL_Rect* dst, SDL_RendererFlip flip) {
+        if (spriteCache && !flashing) {
+            spriteCache->copyEx(renderer, texture, src, dst, 0.0, nullptr, flip);
+        } else {
+            Draw::copyEx(renderer, texture, src, dst, 0.0, nullptr, flip);
         }
     }
 
-    void updateWasps(std::vector<Wasp>&wasps, Frog & player, int speed) {
-        for (auto it = wasps.begin(); it != wasps.end(); )
-        {
-            if (!it->active || it->pendingRemoval) {
-                // Ensure health bar is properly cleaned up before removal
-                if (it->health) {
-                    delete it->health;
-                    it->health = nullptr;
-                }
-                it = wasps.erase(it);
-            }
-            else {
-                it->moveTowards(player, speed);
-                it->updateHealthBar();
-                it->updateDamageTimer(1.0f/60.0f); // Update damage cooldown timer
-                ++it;
+    // Only between ticks: the world is idle
+    void applyInput() {
+        for (const FrogInput& input : pendingInput) {
+            switch (input.type) {
+                case FrogInput::JUMP: world->jumpFrog(input.x, input.y); break;
+                case FrogInput::GRAPPLE: world->grappleFrog(input.x, input.y); break;
+                case FrogInput::SHOOT: world->shootAt(input.x, input.y); break;
+                case FrogInput::RELOAD: world->reloadGun(); break;
+                case FrogInput::STOP:
+                    if (world->getFrog().getState() != Frog::State::GRAPPLING) {
+                        world->getFrog().stopMoving();
+                    }
+                    break;
             }
         }
-    }
+        pendingInput.clear();
 
-    void updateTurtles() {
-        for (auto it = turtles.begin(); it != turtles.end(); ) {
-            if (it->pendingRemoval) {
-                // Ensure health bar is properly cleaned up before removal
-                if (it->health) {
-                    delete it->health;
-                    it->health = nullptr;
-                }
-                it = turtles.erase(it);
-            } else {
-                it->hideinShell(frog);
-                it->updateMovement();
-                it->updateHealthBar();
-                it->fireBullet(bullets, frog, 1.0f/60.0f, currentRenderer, bulletTexture);
-                ++it;
-            }
-        }
+        int mouseX, mouseY;
+        SDL_GetMouseState(&mouseX, &mouseY);
+        world->aimGun(mouseX, mouseY);
     }
 
-    void updateBullets(std::vector<Bullet>&bullets, Frog & player) {
-        SDL_Rect frogBox = frog.getCollisionBox();
-
-        for (auto it = bullets.begin(); it != bullets.end(); ) {
-            SDL_Rect bulletBox = it->rect;
-            // Check if the bullet's rectangle intersects with the frog's rectangle
-            if (SDL_HasIntersection(&bulletBox, &frogBox)) {
-                // Apply damage to the frog when hit by a bullet
-                frog.takeDamage(BULLET_DAMAGE);
-                flashManager->startFlash(&frog); // Start flash effect
-                it = bullets.erase(it);  // Remove the bullet after dealing damage
-            }
-            else {
-                ++it; // Continue to the next bullet
-            }
-        }
+    // Copy the finished tick out for Render, and report its counts
+    void publish() {
+        {
+            PROFILE_SCOPE("update.snapshot");
+            snapshot->capture(*world);
+        }
+
+        // Entity counts for hitch dumps, and as counter tracks under a trace
+        recordCount("wasps", getWaspCount());
+        recordCount("turtles", getTurtleCount());
+        recordCount("enemy bullets", getEnemyBulletCount());
+        recordCount("rain drops", getRainCount());
+        recordCount("pellets", getPelletCount());
+        recordCount("water rings", getWaterRingCount());
+        recordCount("trail particles", getTrailParticleCount());
     }
 
 public:
     gameplay(GameStateManager& manager) 
-        : frog(1280.0f / 2, 720.0f / 2), 
-          spritesheet(nullptr), 
-          tongueTip(nullptr), 
-          turtleTexture(nullptr), 
-          shellTexture(nullptr), 
-          bulletTexture(nullptr), 
-          waspTexture(nullptr), 
-          shotgun(nullptr), 
-          currentRenderer(nullptr),
-          stateManager(manager),
+        : stateManager(manager),
           pixelFont(nullptr),
           pixelFontOutline(nullptr) {
-        rainSystem = std::make_unique<RainSystem>(SCREEN_WIDTH, SCREEN_HEIGHT);
-        flashManager = hurtFlash::getInstance();
         whiteColor = {255, 255, 255, 255};
         brownColor = {154, 77, 1, 255};
+        pendingInput.reserve(16);
+    }
+
+    // Start decoding everything Render will ask for, so starting a match only
+    // has to upload what's left
+    static void prefetchTextures() {
+        AssetManager* assets = AssetManager::getInstance();
+        for (const char* path : {FROG_TEXTURE, TONGUE_TIP_TEXTURE, WASP_TEXTURE,
+                                 TURTLE_TEXTURE, SHELL_TEXTURE, BULLET_TEXTURE}) {
+            assets->loadTextureAsync(path);
+        }
+        DefaultShotgun::prefetchTextures();
     }
 
     void setTerrain(std::shared_ptr<TerrainGrid> t) {
@@ -299,14 +291,40 @@ public:
         terrainElems = te;
     }
 
+    void setOptions(const GameOptions& o) {
+        options = o;
+    }
+
+    // Frog actions from the mouse and keyboard, queued for the next tick
+    void jumpFrog(int xDir, int yDir) { pendingInput.push_back({FrogInput::JUMP, xDir, yDir}); }
+    void grappleFrog(int x, int y) { pendingInput.push_back({FrogInput::GRAPPLE, x, y}); }
+    void shootAt(int x, int y) { pendingInput.push_back({FrogInput::SHOOT, x, y}); }
+    void reloadGun() { pendingInput.push_back({FrogInput::RELOAD, 0, 0}); }
+
+    // Scenario runs drive the world directly between ticks, so they turn
+    // pipelining off; null until Render has loaded the textures
+    bool isLoaded() const { return world && waspTexture && turtleTexture; }
+    World* getWorld() { return world.get(); }
+
+    // These read the live world: only between ticks (publish, scenario runs)
+    int getWaspCount() const { return world ? world->getWaspCount() : 0; }
+    int getTurtleCount() const { return world ? world->getTurtleCount() : 0; }
+    int getEnemyBulletCount() const { return world ? world->getEnemyBulletCount() : 0; }
+    int getRainCount() const { return world ? world->getRainCount() : 0; }
+    int getPelletCount() const { return world ? world->getPelletCount() : 0; }
+    int getWaterRingCount() const { return world ? world->getWaterRingCount() : 0; }
+    int getTrailParticleCount() const { return world ? world->getTrailParticleCount() : 0; }
+
     void Init() override {
         pixelFont = loadFont("pixelFont.ttf", 32);
         pixelFontOutline = loadFont("pixelFontOutline.ttf", 32);
     }
 
     void HandleEvents(SDL_Event& event) override {
-        // Handle escape key when frog is dead
-        if (frog.getState() == Frog::State::DEAD) {
+        if (!world) return;
+
+        // Handle escape key when frog is dead (as last drawn; the world may be mid-tick)
+        if (snapshot->frog.state == Frog::State::DEAD) {
             const Uint8* keys = SDL_GetKeyboardState(nullptr);
             if (keys[SDL_SCANCODE_ESCAPE]) {
                 stateManager.PopState();  // Return to menu
@@ -336,13 +354,13 @@ public:
             }
 
             // Handle jumping with space - can only jump when grounded
-            if (keys[SDL_SCANCODE_SPACE] && frog.getGrounded()) {
-                frog.jump(static_cast<float>(xDir), static_cast<float>(yDir));
+            if (keys[SDL_SCANCODE_SPACE]) {
+                jumpFrog(xDir, yDir);
             }
 
             // Handle reload with R key
-            if (keys[SDL_SCANCODE_R] && shotgun) {
-                shotgun->reload();
+            if (keys[SDL_SCANCODE_R]) {
+                reloadGun();
             }
         }
         
@@ -353,208 +371,163 @@ public:
             
             // Right click to grapple
             if (event.button.button == SDL_BUTTON_RIGHT) {
-                frog.grapple(mouseX, mouseY);
+                grappleFrog(mouseX, mouseY);
             // Left click to shoot
-            } else if (event.button.button == SDL_BUTTON_LEFT && shotgun) {
-                // Get frog position for shooting
-                SDL_Rect frogBox = frog.getCollisionBox();
-                shotgun->shoot(frogBox.x + frogBox.w/2, frogBox.y + frogBox.h/2, mouseX, mouseY);
+            } else if (event.button.button == SDL_BUTTON_LEFT) {
+                shootAt(mouseX, mouseY);
             }
         }
         
-        // Stop movement when keys are released
+        // Stop movement when keys are released (unless grappling, checked when it's applied)
         if (event.type == SDL_KEYUP) {
             if (!keys[SDL_SCANCODE_W] && !keys[SDL_SCANCODE_S] && 
-                !keys[SDL_SCANCODE_A] && !keys[SDL_SCANCODE_D]
-                 && frog.getState() != Frog::State::GRAPPLING) {
-                frog.stopMoving();
+                !keys[SDL_SCANCODE_A] && !keys[SDL_SCANCODE_D]) {
+                pendingInput.push_back({FrogInput::STOP, 0, 0});
             }
         }
     }
 
     void Update(float deltaTime) override {
-        if (!currentRenderer) return;  // Skip update if renderer isn't ready
-
-        // Update flash effects
-        flashManager->update(deltaTime);
-
-        // Update rain
-        if (rainSystem) {
-            rainSystem->update(deltaTime);
-        }
-
-        // Update water physics and check if frog is on water
-        if (waterPhysics && terrain) {
-            waterPhysics->update(deltaTime, *terrain);
-            
-            // Check if frog is on water and update its state
-            SDL_Rect frogBox = frog.getCollisionBox();
-            int gridX = frogBox.x / terrain->getCellSize();
-            int gridY = frogBox.y / terrain->getCellSize();
-            bool isOnWater = terrain->isWater(gridX, gridY);
-            
-            // Update frog's water state
-            frog.setOnWater(isOnWater);
-            
-            // Add water ring at frog's position if on water
-            if (isOnWater) {
-                waterPhysics->addFrogRing(frogBox.x + frogBox.w/2, frogBox.y + frogBox.h/2);
-            }
+        if (!world) return;  // Skip update until Render has built the world
+
+        if (simulation) {
+            // Last frame's tick is done: hand it to Render, then simulate the next
+            // one while that's drawn. What's on screen is a tick behind the world.
+            {
+                TRACE_SCOPE("simulation.wait");
+                simulation->wait();
+            }
+            publish();
+            applyInput();
+            simulation->start(deltaTime);
+        } else {
+            applyInput();
+            world->update(deltaTime);
+            publish();
         }
-        
-        // Update frog's position and state
-        frog.update(deltaTime);
-        
-        // Check enemy collisions if frog is alive
-        if (frog.getState() != Frog::State::DEAD) {
-            checkEnemyCollisions();
-        }
-        
-        // Update shotgun and check for bullet collisions
-        if (shotgun) {
-            shotgun->update(deltaTime);
-            shotgun->updateBullets();
-            checkBulletCollisions(currentRenderer);
-        }
-
-        static int frameCount = 0; // Track frame count to control spawning
-        frameCount++;
-
-        // Spawn turtles and wasps once every few frames
-        for (int i = 0; i < numTurtlesSpawned; i++)
-            Turtle::spawnTurtles(turtles, frameCount, turtleTexture, currentRenderer, 0);
-        // Spawn several wasps at a time
-        for (int i = 0; i < numWaspsSpawned; i++)
-            Wasp::spawnWasps(wasps, frameCount, waspTexture, currentRenderer);
-        
-        // Update turt bullets
-        updateBullets(bullets, frog);
-        
-        // Update wasps
-        updateWasps(wasps, frog, 3);
-
-        // Update turtles
-        updateTurtles();
     }
 
     void Render(SDL_Renderer* renderer) override {
-        currentRenderer = renderer;  // Store renderer for use in Update
-
-        // Load the spritesheet if it hasn't been loaded yet
-        if (!spritesheet || !tongueTip) {
+        // Load everything and build the world on the first frame, before a
+        // simulation thread starts stepping it
+        if (!world) {
             //ASSET LOADING - CHANGE ASSETS HERE
-            spritesheet = IMG_LoadTexture(renderer, "assets/frog.png");
-            tongueTip = IMG_LoadTexture(renderer, "assets/tongue_tip.png");
-            if (!spritesheet || !tongueTip) {
-                SDL_Log("Failed to load texture: %s", IMG_GetError());
-            }
-            if (spritesheet) {
-                frog.addAnimation(frogIdle, spritesheet, 16, 14, 1, 0);
-                frog.addAnimation(frogGrappling, spritesheet, 16, 14, 1, 0);
-                frog.addAnimation(frogJumping, spritesheet, 16, 14, 1, 0);
-                frog.addAnimation(frogFalling, spritesheet, 16, 14, 1, 0);
-                frog.addAnimation(frogDead, spritesheet, 16, 14, 1, 0);
-                
-                // Initialize frog's health bar
-                frog.initializeHealthBar(renderer, FROG_MAX_HEALTH);
-            }
+            spritesheet = loadTexture(FROG_TEXTURE, renderer);
+            tongueTip = loadTexture(TONGUE_TIP_TEXTURE, renderer);
 
             // Load mob textures if they are not already loaded
             if (!waspTexture) {
-                waspTexture = loadTexture("assets/wasp.png", renderer);
+                waspTexture = loadTexture(WASP_TEXTURE, renderer);
                 if (waspTexture) {
-                    SDL_SetTextureBlendMode(waspTexture, SDL_BLENDMODE_BLEND);
+                    SDL_SetTextureBlendMode(waspTexture.get(), SDL_BLENDMODE_BLEND);
                 }
             }
             if (!turtleTexture) {
-                turtleTexture = loadTexture("assets/turtle.png", renderer);
+                turtleTexture = loadTexture(TURTLE_TEXTURE, renderer);
             }
             if (!shellTexture) {
-                shellTexture = loadTexture("assets/shell.png", renderer);
+                shellTexture = loadTexture(SHELL_TEXTURE, renderer);
             }
             if (!bulletTexture) {
-                bulletTexture = loadTexture("assets/bulletNew.png", renderer);
-            }
-            if (bulletTexture == nullptr) {
-                std::cout << "Failed to load bullet texture: " << IMG_GetError() << std::endl;
-            }
-            
-            // Initialize shotgun after renderer is available
-            if (!shotgun) {
-                shotgun = new DefaultShotgun(renderer);
+                bulletTexture = loadTexture(BULLET_TEXTURE, renderer);
             }
 
-            // Create terrain if not provided
-            if (!terrain) {
-                terrain = std::make_shared<TerrainGrid>(renderer, 64, 36, 20);
-                terrain->generate();
+            // The world builds the shotgun, water and rain, and a map if the menu didn't pass one
+            world = std::make_unique<World>(options, renderer, terrain);
+            world->setEnemyTextures(waspTexture.get(), turtleTexture.get());
+
+            if (spritesheet) {
+                Frog& frog = world->getFrog();
+
+                // One sheet for every state; the frog only borrows it
+                frog.addAnimation(frogIdle, spritesheet.get(), 16, 14, 1, 0);
+                frog.addAnimation(frogGrappling, spritesheet.get(), 16, 14, 1, 0);
+                frog.addAnimation(frogJumping, spritesheet.get(), 16, 14, 1, 0);
+                frog.addAnimation(frogFalling, spritesheet.get(), 16, 14, 1, 0);
+                frog.addAnimation(frogDead, spritesheet.get(), 16, 14, 1, 0);
             }
-            
+
             // Create terrain elements if not provided
             if (!terrainElems) {
-                terrainElems = std::make_shared<terrainElements>(renderer, terrain.get(), SCREEN_WIDTH, SCREEN_HEIGHT);
+                terrainElems = std::make_shared<terrainElements>(renderer, world->getTerrain(), SCREEN_WIDTH, SCREEN_HEIGHT);
                 terrainElems->generate();
             }
+            background = std::make_unique<BackgroundLayer>(SCREEN_WIDTH, SCREEN_HEIGHT);
+
+            flashTints = std::make_unique<FlashTints>();
+            for (SDL_Texture* texture : {spritesheet.get(), waspTexture.get(), turtleTexture.get(), shellTexture.get()}) {
+                flashTints->prepare(renderer, texture);
+            }
+
+            if (SpriteCache::wanted(renderer, options.spriteCache)) {
+                spriteCache = std::make_unique<SpriteCache>(1);
+                gunSprites = std::make_unique<SpriteCache>(GUN_SPRITE_ANGLES);
+                world->getShotgun()->setSpriteCache(gunSprites.get());  // The snapshot's copy shares it
+            }
 
-            // Initialize water physics system
-            if (!waterPhysics) {
-                waterPhysics = std::make_unique<WaterPhysics>(renderer);
+            snapshot = std::make_unique<WorldSnapshot>(*world);
+            if (options.pipelined) {
+                simulation = std::make_unique<SimulationThread>(*world);
             }
         }
 
+        // Everything below draws the snapshot, never the world: it may be mid-tick
+        WorldSnapshot::FrogView& frog = snapshot->frog;
+        WaterPhysics* waterPhysics = snapshot->water.get();
+        RainSystem* rainSystem = snapshot->rain.get();
+        DefaultShotgun* shotgun = snapshot->shotgun.get();
+
         SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-        SDL_RenderClear(renderer);
+        Draw::clear(renderer);
 
-        // Render terrain first as background
-        if (terrain) {
-            terrain->render(renderer);
-        }
-        
-        // Render terrain elements
-        if (terrainElems) {
-            terrainElems->render();
+        // Render terrain and its elements first as background, one copy unless the map changed
+        {
+            PROFILE_SCOPE("render.background");
+            background->render(renderer, snapshot->terrain, terrainElems.get());
         }
 
         // Render water effects after terrain but before entities
         if (waterPhysics) {
+            PROFILE_SCOPE("render.water");
             waterPhysics->render(renderer);
         }
 
         // Render rain after water effects but before entities
         if (rainSystem) {
+            PROFILE_SCOPE("render.rain");
             rainSystem->render(renderer);
         }
 
         // Get the current animation frame and texture
-        SDL_Rect srcRect = frog.getCurrentFrame();
-        SDL_Rect destRect = frog.getCollisionBox();
-        SDL_Texture* currentTexture = frog.getCurrentTexture();
+        SDL_Rect srcRect = frog.frame;
+        SDL_Rect destRect = frog.box;
+        SDL_Texture* currentTexture = frog.texture;
         
         if (currentTexture) {
+            PROFILE_SCOPE("render.frog");
+
             // Flip the texture based on the direction the frog is facing
-            SDL_RendererFlip flip = (frog.getFacing() == Frog::Direction::LEFT) ? 
+            SDL_RendererFlip flip = (frog.facing == Frog::Direction::LEFT) ? 
                                    SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE;
             
             // Get potentially flashing texture
-            SDL_Texture* displayTexture = flashManager->getFilledImage(renderer, currentTexture, &frog);
+            SDL_Texture* displayTexture = flashTints->get(renderer, currentTexture, frog.flash);
             
             // Render the frog
-            SDL_RenderCopyEx(renderer, displayTexture, &srcRect, &destRect, 
-                           0.0, nullptr, flip);
-            
-            // Clean up if a new texture was created
-            if (displayTexture != currentTexture) {
-                SDL_DestroyTexture(displayTexture);
-            }
+            drawSprite(renderer, displayTexture, displayTexture != currentTexture, &srcRect, &destRect, flip);
             
             // Draw the frog's health bar
-            frog.drawHealthBar();
+            if (frog.hasHealth) {
+                frog.health.draw();
+            }
         }
 
-        if (frog.getState() == Frog::State::GRAPPLING) {
+        if (frog.state == Frog::State::GRAPPLING) {
+            PROFILE_SCOPE("render.tongue");
+
             // Calculate tongue start position (frog's mouth)
             // Make sure the tongue always comes from the center of the mouth
-            int xOff = (frog.getFacing() == Frog::Direction::RIGHT) ? 10 : -10;
+            int xOff = (frog.facing == Frog::Direction::RIGHT) ? 10 : -10;
 
             int startX = destRect.x + destRect.w/2 + (xOff);
             int startY = destRect.y + destRect.h/2 + 4;
@@ -595,11 +568,11 @@ public:
 
                 int startOffsetX = startX + static_cast<int>(perpX * offset);
                 int startOffsetY = startY + static_cast<int>(perpY * offset);
-                int endOffsetX = frog.getGrappleX() + static_cast<int>(perpX * offset);
-                int endOffsetY = frog.getGrappleY() + static_cast<int>(perpY * offset);
+                int endOffsetX = frog.grappleX + static_cast<int>(perpX * offset);
+                int endOffsetY = frog.grappleY + static_cast<int>(perpY * offset);
 
                 for(int j = 0; j < 2; j++) {
-                    SDL_RenderDrawLine(renderer, 
+                    Draw::line(renderer, 
                         startOffsetX + j, startOffsetY,
                         endOffsetX + j, endOffsetY);
                 }
@@ -608,69 +581,64 @@ public:
             // Render tongue tip
             if (tongueTip) {
                 SDL_Rect tipRect = {
-                    static_cast<int>(frog.getGrappleX()) - 8,
-                    static_cast<int>(frog.getGrappleY()) - 8,
+                    static_cast<int>(frog.grappleX) - 8,
+                    static_cast<int>(frog.grappleY) - 8,
                     16, 16
                 };
-                SDL_RenderCopy(renderer, tongueTip, nullptr, &tipRect);
+                Draw::copy(renderer, tongueTip.get(), nullptr, &tipRect);
             }
         }
 
         // Render wasps and turtles
-        for (auto& wasp : wasps) 
         {
-            if (!wasp.pendingRemoval) {  // Only render if not pending removal
+            PROFILE_SCOPE("render.wasps");
+            for (auto& wasp : snapshot->wasps) 
+            {
                 SDL_RendererFlip flip = (wasp.facingRight) ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE;
-                SDL_Texture* displayTexture = flashManager->getFilledImage(renderer, wasp.texture, &wasp);
-                SDL_RenderCopyEx(renderer, displayTexture, nullptr, &wasp.rect, 0.0, nullptr, flip);
-                if (displayTexture != wasp.texture) {
-                    SDL_DestroyTexture(displayTexture);
+                SDL_Texture* displayTexture = flashTints->get(renderer, wasp.texture, wasp.flash);
+                drawSprite(renderer, displayTexture, displayTexture != wasp.texture, nullptr, &wasp.rect, flip);
+                if (wasp.showHealth) {
+                    wasp.health.draw();
                 }
-                wasp.renderHealthBar(renderer);
             }
         }
 
         // Render turtles with flash effect
-        for (auto& turtle : turtles) {
-            if (!turtle.pendingRemoval) {
-                SDL_Texture* baseTexture = turtle.hiding ? shellTexture : turtleTexture;
-                SDL_Texture* displayTexture = flashManager->getFilledImage(renderer, baseTexture, &turtle);
+        {
+            PROFILE_SCOPE("render.turtles");
+            for (auto& turtle : snapshot->turtles) {
+                SDL_Texture* baseTexture = turtle.hiding ? shellTexture.get() : turtleTexture.get();
+                SDL_Texture* displayTexture = flashTints->get(renderer, baseTexture, turtle.flash);
                 SDL_RendererFlip flip = (turtle.facingRight) ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE;
-                SDL_RenderCopyEx(renderer, displayTexture, nullptr, &turtle.rect, 0.0, nullptr, flip);
-                if (displayTexture != baseTexture) {
-                    SDL_DestroyTexture(displayTexture);
+                drawSprite(renderer, displayTexture, displayTexture != baseTexture, nullptr, &turtle.rect, flip);
+                if (turtle.showHealth) {
+                    turtle.health.draw();
                 }
-                turtle.renderHealthBar(renderer);
             }
         }
 
         // Render bullets (if any)
-        for (const auto& bullet : bullets) 
         {
-            SDL_RenderCopy(renderer, bulletTexture, nullptr, &bullet.rect);
-        }
-
-        if (!waspTexture) {
-            SDL_Log("Failed to load wasp texture: %s", IMG_GetError());
-        }
-
-        if (!turtleTexture) {
-            SDL_Log("Failed to load turtle texture: %s", IMG_GetError());
+            PROFILE_SCOPE("render.bullets");
+            snapshot->enemyProjectiles.render(renderer, bulletTexture.get());
         }
 
         // Finally, render the shotgun
         // Render bullet trails and shells
         if (shotgun) {
+            PROFILE_SCOPE("render.shotgun");
             shotgun->render(renderer, destRect.x + destRect.w/2, destRect.y + destRect.h/2);
         }
+    }
 
+    void RenderHUD(SDL_Renderer* renderer) override {
         // Render game over overlay and text when frog is dead
-        if (frog.getState() == Frog::State::DEAD) {
+        if (snapshot && snapshot->frog.state == Frog::State::DEAD) {
             // Create semi-transparent dark overlay
             SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
             SDL_SetRenderDrawColor(renderer, 0, 0, 0, 192);  // 75% opacity black
             SDL_Rect overlay = {0, 0, SCREEN_WIDTH, SCREEN_HEIGHT};
-            SDL_RenderFillRect(renderer, &overlay);
+            Draw::fillRect(renderer, &overlay);
 
             // Render game over text
             renderTextPair(renderer, "GAME OVER", 
@@ -683,35 +651,20 @@ public:
     }
 
     void CleanUp() override {
-        currentRenderer = nullptr;  // Clear renderer reference
-        if (spritesheet) {
-            SDL_DestroyTexture(spritesheet);
-            spritesheet = nullptr;
-        }
-        if (tongueTip) {
-            SDL_DestroyTexture(tongueTip);
-            tongueTip = nullptr;
-        }
-        if (shotgun) {
-            delete shotgun;
-            shotgun = nullptr;
-        }
-        if (turtleTexture) {
-            SDL_DestroyTexture(turtleTexture);
-            turtleTexture = nullptr;
-        }
-        if (shellTexture) {
-            SDL_DestroyTexture(shellTexture);
-            shellTexture = nullptr;
-        }
-        if (bulletTexture) {
-            SDL_DestroyTexture(bulletTexture);
-            bulletTexture = nullptr;
-        }
-        if (waspTexture) {
-            SDL_DestroyTexture(waspTexture);
-            waspTexture = nullptr;
-        }
+        simulation.reset();  // Joins the thread before the world it steps goes
+        snapshot.reset();
+        world.reset();  // Its enemies point at the textures below
+        spriteCache.reset();  // Baked from those textures too
+        gunSprites.reset();
+        background.reset();
+        flashTints.reset();  // Made from the textures below
+        // Drop our texture handles; the AssetManager keeps them for the next game
+        spritesheet.reset();
+        tongueTip.reset();
+        turtleTexture.reset();
+        shellTexture.reset();
+        bulletTexture.reset();
+        waspTexture.reset();
         if (pixelFont) {
             TTF_CloseFont(pixelFont);
             pixelFont = nullptr;
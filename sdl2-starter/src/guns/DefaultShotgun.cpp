@@ -1,7 +1,22 @@
 #include "DefaultShotgun.h"
+#include "../render/RenderRecorder.h"
 #include <SDL2/SDL_image.h>
 
-DefaultShotgun::DefaultShotgun(SDL_Renderer* renderer) : GunTemplate() {
+// Trails and shells are stepped at a fixed rate
+static const float PARTICLE_STEP = 0.016f;  // Assuming 60 FPS
+
+static const char* const GUN_PATH = "assets/shotgun.png";
+static const char* const RELOAD_PATH = "assets/shotgunReload.png";
+static const char* const SHELL_PATH = "assets/medShell.png";
+static const char* const SHELL_ICON_PATH = "assets/shellIcon.png";
+static const char* const SHELL_ICON_EMPTY_PATH = "assets/noShellIcon.png";
+
+DefaultShotgun::DefaultShotgun(SDL_Renderer* renderer, uint32_t seed)
+    : GunTemplate(),
+      shells(MAX_SHELLS, ParticleShape::SPRITE),
+      trailParticles(MAX_TRAIL_PARTICLES, ParticleShape::QUAD),
+      batch(MAX_TRAIL_PARTICLES),
+      spriteCache(nullptr) {
     // Initialize gun properties with lower ammo count
     setMaxAmmo(2);  // Only 2 shells at a time
     setReloadTime(1.0f);
@@ -10,15 +25,14 @@ DefaultShotgun::DefaultShotgun(SDL_Renderer* renderer) : GunTemplate() {
     setBulletDamage(3);
     setBulletLifetime(0.3f);
     
-    // Load textures
-    gunTexture = IMG_LoadTexture(renderer, "assets/shotgun.png");
-    reloadTexture = IMG_LoadTexture(renderer, "assets/shotgunReload.png");
-    shellTexture = IMG_LoadTexture(renderer, "assets/medShell.png");
-    shellIcon = IMG_LoadTexture(renderer, "assets/shellIcon.png");
-    shellIconEmpty = IMG_LoadTexture(renderer, "assets/noShellIcon.png");
-    
-    if (!gunTexture || !reloadTexture || !shellTexture) {
-        SDL_Log("Failed to load shotgun textures: %s", IMG_GetError());
+    // Load textures (cached, so a new game's shotgun doesn't read them again)
+    if (renderer) {
+        AssetManager* assets = AssetManager::getInstance();
+        gunTexture = assets->getTexture(renderer, GUN_PATH);
+        reloadTexture = assets->getTexture(renderer, RELOAD_PATH);
+        shellTexture = assets->getTexture(renderer, SHELL_PATH);
+        shellIcon = assets->getTexture(renderer, SHELL_ICON_PATH);
+        shellIconEmpty = assets->getTexture(renderer, SHELL_ICON_EMPTY_PATH);
     }
     
     // Initialize gun position and size
@@ -28,18 +42,31 @@ DefaultShotgun::DefaultShotgun(SDL_Renderer* renderer) : GunTemplate() {
     gunOffset = {0, 12};       // Offset from frog's center
     gunPivot = {10, 10};       // Pivot point for rotation (adjust based on sprite)
     gunRotation = 0.0f;
+
+    // Shells fall with gravity and spin; trails are small yellow squares that fade out
+    shells.setTexture(shellTexture.get());
+    shells.setGravity(500.0f);
+    shells.setFadeOut(false);
+    trailParticles.setColor(255, 255, 0);
     
     // Initialize random number generator
-    rng.seed(std::time(nullptr));
+    rng.seed(seed != 0 ? seed : static_cast<uint32_t>(std::time(nullptr)));
 }
 
 DefaultShotgun::~DefaultShotgun() {
-    // Clean up textures
-    if (gunTexture) SDL_DestroyTexture(gunTexture);
-    if (reloadTexture) SDL_DestroyTexture(reloadTexture);
-    if (shellTexture) SDL_DestroyTexture(shellTexture);
-    if (shellIcon) SDL_DestroyTexture(shellIcon);
-    if (shellIconEmpty) SDL_DestroyTexture(shellIconEmpty);
+    // Textures are released with their handles
+}
+
+void DefaultShotgun::setSpriteCache(SpriteCache* cache) {
+    spriteCache = cache;
+    shells.setSpriteCache(cache);
+}
+
+void DefaultShotgun::prefetchTextures() {
+    AssetManager* assets = AssetManager::getInstance();
+    for (const char* path : {GUN_PATH, RELOAD_PATH, SHELL_PATH, SHELL_ICON_PATH, SHELL_ICON_EMPTY_PATH}) {
+        assets->loadTextureAsync(path);
+    }
 }
 
 void DefaultShotgun::shoot(int startX, int startY, int aimX, int aimY) {
@@ -60,10 +87,8 @@ void DefaultShotgun::shoot(int startX, int startY, int aimX, int aimY) {
         int spreadTargetX = startX + static_cast<int>(cos(spreadAngle) * targetDist);
         int spreadTargetY = startY + static_cast<int>(sin(spreadAngle) * targetDist);
         
-        // Add bullet and initialize its trail
+        // Add bullet; its trail is emitted from its position as it flies
         addBullet(startX, startY, spreadTargetX, spreadTargetY);
-        bulletTrails[nextBulletId-1] = BulletTrail();
-        bulletTrails[nextBulletId-1].angle = spreadAngle;
     }
 
     // Decrease ammo and set cooldown
@@ -81,50 +106,14 @@ void DefaultShotgun::setGunState(gunState state) {
 }
 
 void DefaultShotgun::updateBullets() {
-    // Update bullet trails
-    for (auto& [id, trail] : bulletTrails) {
-        // Add new particles behind the bullet
-        if (activeBullets.count(id) > 0) {
-            addParticlesBehindBullet(id, activeBullets[id]);
-        }
-        
-        // Update existing particles
-        auto& particles = trail.particles;
-        for (auto it = particles.begin(); it != particles.end();) {
-            it->lifetime -= 0.016f;  // Assuming 60 FPS
-            it->alpha = (it->lifetime / 0.2f) * 255;  // Fade out over 0.2 seconds
-            
-            if (it->lifetime <= 0) {
-                it = particles.erase(it);
-            } else {
-                ++it;
-            }
-        }
-    }
-
-    // Clean up trails for deleted bullets
-    for (auto it = bulletTrails.begin(); it != bulletTrails.end();) {
-        if (activeBullets.count(it->first) == 0 && it->second.particles.empty()) {
-            it = bulletTrails.erase(it);
-        } else {
-            ++it;
-        }
+    // Add new particles behind every live bullet
+    for (const auto& bullet : activeBullets) {
+        addParticlesBehindBullet(bullet);
     }
 
-    // Update shells
-    for (auto it = activeShells.begin(); it != activeShells.end();) {
-        it->velocityY += 500.0f * 0.016f;  // Gravity
-        it->pos.x += static_cast<int>(it->velocityX * 0.016f);
-        it->pos.y += static_cast<int>(it->velocityY * 0.016f);
-        it->rotation += 360.0f * 0.016f;  // Rotate 360 degrees per second
-        it->lifetime -= 0.016f;
-
-        if (it->lifetime <= 0) {
-            it = activeShells.erase(it);
-        } else {
-            ++it;
-        }
-    }
+    // Fade trails and move shells (gravity and spin are handled by the pool)
+    trailParticles.update(PARTICLE_STEP);
+    shells.update(PARTICLE_STEP);
 }
 
 void DefaultShotgun::updateGunPosition(int frogX, int frogY, int mouseX, int mouseY) {
@@ -157,8 +146,8 @@ void DefaultShotgun::renderAmmoIcons(SDL_Renderer* renderer, int frogX, int frog
         };
         
         // Choose texture based on whether this slot has ammo
-        SDL_Texture* iconTexture = (i < currentAmmo) ? shellIcon : shellIconEmpty;
-        SDL_RenderCopy(renderer, iconTexture, nullptr, &iconRect);
+        SDL_Texture* iconTexture = (i < currentAmmo) ? shellIcon.get() : shellIconEmpty.get();
+        Draw::copy(renderer, iconTexture, nullptr, &iconRect);
     }
 }
 
@@ -172,82 +161,57 @@ void DefaultShotgun::render(SDL_Renderer* renderer, int frogX, int frogY) {
     updateGunPosition(frogX, frogY, mouseX, mouseY);
 
     // Render bullet trails
-    for (const auto& [id, trail] : bulletTrails) {
-        for (const auto& particle : trail.particles) {
-            // Set color to bright yellow with alpha
-            SDL_SetRenderDrawColor(renderer, 255, 255, 0, static_cast<Uint8>(particle.alpha));
-            
-            // Draw particle as a small rectangle
-            SDL_Rect particleRect = {
-                static_cast<int>(particle.x - 2),
-                static_cast<int>(particle.y - 2),
-                4, 4
-            };
-            SDL_RenderFillRect(renderer, &particleRect);
-        }
-
-        // If bullet is still active, draw a bright streak at its position
-        if (activeBullets.count(id) > 0) {
-            const auto& bullet = activeBullets[id];
-            
-            // Draw a bright yellow streak in the direction of movement
-            float streakLength = 12.0f;
-            int endX = bullet.bulletPos.x - static_cast<int>(cos(trail.angle) * streakLength);
-            int endY = bullet.bulletPos.y - static_cast<int>(sin(trail.angle) * streakLength);
-            
-            // Draw multiple lines for thickness
-            for (int i = -1; i <= 1; i++) {
-                SDL_SetRenderDrawColor(renderer, 255, 255, 0, 255);
-                SDL_RenderDrawLine(renderer,
-                    bullet.bulletPos.x + i, bullet.bulletPos.y,
-                    endX + i, endY);
-            }
-        }
+    trailParticles.render(renderer, batch);
+
+    // Draw a bright yellow streak behind each live bullet in its direction of movement
+    const float streakLength = 12.0f;
+    const SDL_Color streakColor = {255, 255, 0, 255};
+    batch.begin(renderer, nullptr);
+    for (const auto& bullet : activeBullets) {
+        float endX = bullet.bulletPos.x - cos(bullet.angle) * streakLength;
+        float endY = bullet.bulletPos.y - sin(bullet.angle) * streakLength;
+        batch.addLine(bullet.bulletPos.x, bullet.bulletPos.y, endX, endY, 3.0f, streakColor);
     }
+    batch.end();
 
     // Render shells
-    for (const auto& shell : activeShells) {
-        SDL_Rect destRect = shell.pos;
-        SDL_Point center = {destRect.w / 2, destRect.h / 2};
-        SDL_RenderCopyEx(renderer, shellTexture, nullptr, &destRect, 
-                       shell.rotation, &center, SDL_FLIP_NONE);
-    }
+    shells.render(renderer, batch);
 
     // Render gun sprite based on state
-    SDL_Texture* currentTexture = (currentState == gunState::RELOAD) ? reloadTexture : gunTexture;
+    SDL_Texture* currentTexture = (currentState == gunState::RELOAD) ? reloadTexture.get() : gunTexture.get();
     if (currentTexture) {
         // Determine if gun should be flipped based on mouse position
         SDL_RendererFlip flip = (mouseX < frogX) ? SDL_FLIP_VERTICAL : SDL_FLIP_NONE;
         
-        SDL_RenderCopyEx(renderer, currentTexture, nullptr, &gunRect, 
-                        gunRotation, &gunPivot, flip);
+        if (spriteCache) {
+            spriteCache->copyEx(renderer, currentTexture, nullptr, &gunRect, gunRotation, &gunPivot, flip);
+        } else {
+            Draw::copyEx(renderer, currentTexture, nullptr, &gunRect, 
+                         gunRotation, &gunPivot, flip);
+        }
     }
 
     // Render ammo icons
     renderAmmoIcons(renderer, frogX, frogY);
 }
 
-void DefaultShotgun::addParticlesBehindBullet(int bulletId, const bullet& b) {
-    auto& trail = bulletTrails[bulletId];
-    
+void DefaultShotgun::addParticlesBehindBullet(const bullet& b) {
     // Add new particle at bullet's position
-    Particle p;
+    ParticleParams p;
     p.x = b.bulletPos.x;
     p.y = b.bulletPos.y;
+    p.width = p.height = 4.0f;
     p.lifetime = 0.2f;  // Particle lives for 0.2 seconds
     p.alpha = 255;
-    
-    trail.particles.push_front(p);
-    
-    // Limit number of particles per trail
-    if (trail.particles.size() > 10) {
-        trail.particles.pop_back();
-    }
+    trailParticles.emit(p);
 }
 
 void DefaultShotgun::ejectShell() {
-    Shell shell;
-    shell.pos = {gunRect.x + gunPivot.x, gunRect.y + gunPivot.y, 16, 8};  // Eject from gun position
+    ParticleParams shell;
+    shell.x = gunRect.x + gunPivot.x;  // Eject from gun position
+    shell.y = gunRect.y + gunPivot.y;
+    shell.width = 16;
+    shell.height = 8;
     
     // Random velocities for natural movement
     std::uniform_real_distribution<float> velDist(-100.0f, 100.0f);
@@ -255,7 +219,8 @@ void DefaultShotgun::ejectShell() {
     shell.velocityY = -200.0f;  // Initial upward velocity
     
     shell.rotation = 0.0f;
+    shell.spin = 360.0f;    // Rotate 360 degrees per second
     shell.lifetime = 2.0f;  // Shell disappears after 2 seconds
     
-    activeShells.push_back(shell);
+    shells.emit(shell);
 }
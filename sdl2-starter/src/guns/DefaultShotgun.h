@@ -7,7 +7,9 @@
 #include <ctime>
 #include <cmath>
 #include <vector>
-#include <deque>
+#include "../particles/ParticleSystem.h"
+#include "../render/SpriteCache.h"
+#include "../AssetManager.h"
 
 // Forward declare SDL_Texture
 struct SDL_Texture;
@@ -18,11 +20,11 @@ struct SDL_Rect;
 class DefaultShotgun : public GunTemplate {
 private:
     // Textures for gun and shells
-    SDL_Texture* gunTexture;      // Normal gun texture
-    SDL_Texture* reloadTexture;   // Texture during reload
-    SDL_Texture* shellTexture;    // Shell ejection texture
-    SDL_Texture* shellIcon;       // Loaded ammo icon
-    SDL_Texture* shellIconEmpty;  // Empty ammo icon
+    TextureHandle gunTexture;      // Normal gun texture
+    TextureHandle reloadTexture;   // Texture during reload
+    TextureHandle shellTexture;    // Shell ejection texture
+    TextureHandle shellIcon;       // Loaded ammo icon
+    TextureHandle shellIconEmpty;  // Empty ammo icon
     
     // Gun position and rotation
     SDL_Point gunOffset;          // Offset from frog's center
@@ -30,45 +32,42 @@ private:
     SDL_Point gunPivot;          // Pivot point for rotation
     SDL_Rect gunRect;            // Position and size of gun sprite
     
-    // Shell ejection system
-    struct Shell {
-        SDL_Rect pos;
-        float velocityX;
-        float velocityY;
-        float rotation;
-        float lifetime;
-    };
-    std::vector<Shell> activeShells;
+    // Ejected shells and bullet trails live in fixed-size particle pools
+    ParticlePool shells;
+    ParticlePool trailParticles;
+    QuadBatch batch;
+    SpriteCache* spriteCache;    // Baked gun and shell rotations, when the renderer wants them
+    static const int MAX_SHELLS = 16;
+    static const int MAX_TRAIL_PARTICLES = 256;
 
-    // Particle system for bullet trails
-    struct Particle {
-        float x, y;
-        float alpha;
-        float lifetime;
-    };
-
-    struct BulletTrail {
-        std::deque<Particle> particles;
-        float angle;
-    };
-
-    std::map<int, BulletTrail> bulletTrails;
     std::mt19937 rng;
 
 public:
-    DefaultShotgun(SDL_Renderer* renderer);
+    // Without a renderer (headless worlds) no textures are loaded; seed 0 picks one from the clock
+    DefaultShotgun(SDL_Renderer* renderer, uint32_t seed = 0);
     ~DefaultShotgun();
 
+    // Start decoding the gun textures in the background, ahead of the constructor
+    static void prefetchTextures();
+
     void shoot(int startX, int startY, int aimX, int aimY) override;
     void setGunState(gunState state) override;
     void updateBullets() override;
     void render(SDL_Renderer* renderer, int frogX, int frogY);
 
+    // Aim from the frog at the mouse. render() does it for the gun it draws; a
+    // world drawn from a snapshot aims its own gun so shells eject from the muzzle
+    void updateGunPosition(int frogX, int frogY, int mouseX, int mouseY);
+
+    int getTrailParticleCount() const { return trailParticles.size(); }
+
+    // Draw the gun and shells from baked rotations (render/SpriteCache.h); the
+    // cache isn't owned, and copies of this gun share it
+    void setSpriteCache(SpriteCache* cache);
+
 private:
-    void updateParticles(float deltaTime);
-    void addParticlesBehindBullet(int bulletId, const bullet& b);
+    void addParticlesBehindBullet(const bullet& b);
     void ejectShell();
-    void updateGunPosition(int frogX, int frogY, int mouseX, int mouseY);
     void renderAmmoIcons(SDL_Renderer* renderer, int frogX, int frogY);
 };
 
@@ -3,9 +3,9 @@
 
 #include <SDL2/SDL.h>
 #include <vector>
-#include <map>
 #include <memory>
 #include <cmath>
+#include "../SlotMap.h"
 
 // This is a general class for all sorts of guns!
 
@@ -16,7 +16,7 @@ public:
         int bulletSpeed;
         int bulletDamage;
         float bulletLifetime;  // in seconds; subtract from this every frame
-        std::vector<int> targetPos; // x and y; find the bullet's angle to the target with this
+        SDL_Point targetPos; // x and y; find the bullet's angle to the target with this
         float angle;  // angle of bullet trajectory
     };
 
@@ -28,9 +28,9 @@ public:
     };
 
     // Constructor
-    GunTemplate() : currentState(gunState::IDLE), reloadTime(1.0f), currentReloadTime(0.0f),
-                    fireRate(0.5f), lastShotTime(0.0f), maxAmmo(10), currentAmmo(0),
-                    nextBulletId(0) {
+    GunTemplate() : currentState(gunState::IDLE), activeBullets(MAX_BULLETS), reloadTime(1.0f),
+                    currentReloadTime(0.0f), fireRate(0.5f), lastShotTime(0.0f), maxAmmo(10),
+                    currentAmmo(0) {
         // Initialize currentAmmo to maxAmmo
         currentAmmo = maxAmmo;
     }
@@ -66,21 +66,19 @@ public:
             lastShotTime -= deltaTime;
         }
 
-        // Update bullets
-        for (auto it = activeBullets.begin(); it != activeBullets.end();) {
-            auto& [id, bullet] = *it;
-            bullet.bulletLifetime -= deltaTime;
-            if (bullet.bulletLifetime <= 0) {
-                it = activeBullets.erase(it);
-            } else {
-                // Update bullet position based on angle and speed
-                float dx = std::cos(bullet.angle) * bullet.bulletSpeed * deltaTime;
-                float dy = std::sin(bullet.angle) * bullet.bulletSpeed * deltaTime;
-                bullet.bulletPos.x += static_cast<int>(dx);
-                bullet.bulletPos.y += static_cast<int>(dy);
-                ++it;
+        // Update bullets in one pass over the packed array, dropping expired ones
+        activeBullets.removeIf([deltaTime](bullet& b) {
+            b.bulletLifetime -= deltaTime;
+            if (b.bulletLifetime <= 0) {
+                return true;
             }
-        }
+            // Update bullet position based on angle and speed
+            float dx = std::cos(b.angle) * b.bulletSpeed * deltaTime;
+            float dy = std::sin(b.angle) * b.bulletSpeed * deltaTime;
+            b.bulletPos.x += static_cast<int>(dx);
+            b.bulletPos.y += static_cast<int>(dy);
+            return false;
+        });
     }
 
     // Getters
@@ -89,7 +87,7 @@ public:
     int getMaxAmmo() const { return maxAmmo; }
     float getReloadTime() const { return reloadTime; }
     float getCurrentReloadTime() const { return currentReloadTime; }
-    const std::map<int, bullet>& getBullets() const { return activeBullets; }
+    const SlotMap<bullet>& getBullets() const { return activeBullets; }
     
     // Setters
     void setFireRate(float rate) { fireRate = rate; }
@@ -104,8 +102,8 @@ public:
 
 protected:
     gunState currentState;
-    std::map<int, bullet> activeBullets;  // map of bullet IDs to bullets
-    int nextBulletId;  // counter for generating unique bullet IDs
+    static const int MAX_BULLETS = 64;  // Enough for several full shotgun blasts in flight
+    SlotMap<bullet> activeBullets;  // packed bullets, addressed by SlotHandle
     
     // Gun properties
     float reloadTime;
@@ -120,8 +118,8 @@ protected:
     int defaultBulletDamage = 1;
     float defaultBulletLifetime = 2.0f;
     
-    // Helper function to create a new bullet
-    void addBullet(int startX, int startY, int targetX, int targetY) {
+    // Helper function to create a new bullet; returns an invalid handle if too many are in flight
+    SlotHandle addBullet(int startX, int startY, int targetX, int targetY) {
         bullet newBullet;
         newBullet.bulletPos = {startX, startY, 8, 8};  // Default bullet size 8x8
         newBullet.bulletSpeed = defaultBulletSpeed;
@@ -134,8 +132,8 @@ protected:
         float dy = targetY - startY;
         newBullet.angle = std::atan2(dy, dx);
         
-        // Add bullet to active bullets map with a unique ID
-        activeBullets[nextBulletId++] = newBullet;
+        // Add bullet to the packed bullet array
+        return activeBullets.insert(newBullet);
     }
 
     // Helper function to check if can shoot
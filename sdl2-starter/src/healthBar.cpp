@@ -1,4 +1,5 @@
 #pragma once
+#include "render/RenderRecorder.h"
 #include <SDL2/SDL.h>
 
 class healthBar {
@@ -128,7 +129,7 @@ public:
         };
         // Red purple
         SDL_SetRenderDrawColor(renderer, 149, 53, 83, 255);
-        SDL_RenderFillRect(renderer, &bgRect);
+        Draw::fillRect(renderer, &bgRect);
 
         // Foreground (current health)
         int currentWidth = static_cast<int>((float)health / MAX_HEALTH * BAR_WIDTH);
@@ -140,6 +141,6 @@ public:
         };
         // Rose red
         SDL_SetRenderDrawColor(renderer, 243, 58, 106, 255);
-        SDL_RenderFillRect(renderer, &healthRect);
+        Draw::fillRect(renderer, &healthRect);
     }
 };
@@ -1,31 +1,37 @@
 #include "hurtFlash.h"
+#include "render/RenderRecorder.h"
+#include "render/RenderTargetScope.h"
+#include <algorithm>
+#include <cmath>
 
-hurtFlash* hurtFlash::instance = nullptr;
+static const size_t RESERVED_FLASHES = 512;  // at once; more only grows the vector
 
-hurtFlash* hurtFlash::getInstance() {
-    if (instance == nullptr) {
-        instance = new hurtFlash();
-    }
-    return instance;
+hurtFlash::hurtFlash() {
+    flashingObjects.reserve(RESERVED_FLASHES);
 }
 
 void hurtFlash::update(float deltaTime) {
-    // Update all flashing objects
-    auto it = flashingObjects.begin();
-    while (it != flashingObjects.end()) {
-        it->second -= deltaTime;
-        if (it->second <= 0) {
-            it = flashingObjects.erase(it);
-        } else {
-            ++it;
+    // Update all flashing objects, dropping the finished ones
+    for (Flash& flash : flashingObjects) {
+        flash.remaining -= deltaTime;
+    }
+    flashingObjects.erase(std::remove_if(flashingObjects.begin(), flashingObjects.end(),
+                                         [](const Flash& flash) { return flash.remaining <= 0; }),
+                          flashingObjects.end());
+}
+
+float hurtFlash::getRemaining(void* objectPtr) const {
+    for (const Flash& flash : flashingObjects) {
+        if (flash.object == objectPtr) {
+            return flash.remaining > 0 ? flash.remaining : 0.0f;
         }
     }
+    return 0.0f;
 }
 
-SDL_Texture* hurtFlash::getFilledImage(SDL_Renderer* renderer, SDL_Texture* tex, void* objectPtr) {
+SDL_Texture* hurtFlash::getFilledImage(SDL_Renderer* renderer, SDL_Texture* tex, float remaining) {
     // Check if it is currently flashing
-    auto it = flashingObjects.find(objectPtr);
-    if (it == flashingObjects.end() || it->second <= 0) {
+    if (remaining <= 0 || !tex) {
         return tex;
     }
 
@@ -44,19 +50,18 @@ SDL_Texture* hurtFlash::getFilledImage(SDL_Renderer* renderer, SDL_Texture* tex,
     // Set the render target to a temporary texture to read pixel data
     SDL_Texture* tempTex = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32, 
                                            SDL_TEXTUREACCESS_TARGET, w, h);
-    SDL_SetRenderTarget(renderer, tempTex);
-    SDL_RenderCopy(renderer, tex, nullptr, nullptr);
-    
-    // Read pixels from the temporary texture
-    SDL_RenderReadPixels(renderer, nullptr, SDL_PIXELFORMAT_RGBA32, 
-                        surface->pixels, surface->pitch);
-    
-    // Reset render target
-    SDL_SetRenderTarget(renderer, nullptr);
+    {
+        RenderTargetScope target(renderer, tempTex);
+        Draw::copy(renderer, tex, nullptr, nullptr);
+
+        // Read pixels from the temporary texture
+        Draw::readPixels(renderer, nullptr, SDL_PIXELFORMAT_RGBA32, 
+                         surface->pixels, surface->pitch);
+    }  // Back to the previous render target
     SDL_DestroyTexture(tempTex);
 
     // Calculate red tint intensity
-    Uint8 redIntensity = static_cast<Uint8>((it->second / flashTime) * 255);
+    Uint8 redIntensity = static_cast<Uint8>((remaining / flashTime) * 255);
 
     // Modify only opaque pixels
     Uint32* pixels = static_cast<Uint32*>(surface->pixels);
@@ -82,5 +87,69 @@ SDL_Texture* hurtFlash::getFilledImage(SDL_Renderer* renderer, SDL_Texture* tex,
 }
 
 void hurtFlash::startFlash(void* objectPtr) {
-    flashingObjects[objectPtr] = flashTime;
+    for (Flash& flash : flashingObjects) {
+        if (flash.object == objectPtr) {
+            flash.remaining = flashTime;
+            return;
+        }
+    }
+    flashingObjects.push_back({objectPtr, flashTime});
+}
+
+FlashTints::~FlashTints() {
+    clear();
+}
+
+void FlashTints::clear() {
+    for (Entry& entry : entries) {
+        for (SDL_Texture* tinted : entry.tinted) {
+            if (tinted && tinted != entry.source) {
+                SDL_DestroyTexture(tinted);
+            }
+        }
+    }
+    entries.clear();
+}
+
+const FlashTints::Entry* FlashTints::build(SDL_Renderer* renderer, SDL_Texture* tex) {
+    Entry entry;
+    entry.source = tex;
+    for (int level = 0; level < LEVELS; level++) {
+        float remaining = hurtFlash::getFlashTime() * (level + 1) / LEVELS;
+        SDL_Texture* tinted = hurtFlash::getFilledImage(renderer, tex, remaining);
+        entry.tinted[level] = tinted ? tinted : tex;  // Untinted rather than missing
+    }
+    entries.push_back(entry);
+    return &entries.back();
+}
+
+void FlashTints::prepare(SDL_Renderer* renderer, SDL_Texture* tex) {
+    if (!tex) return;
+    for (const Entry& entry : entries) {
+        if (entry.source == tex) return;
+    }
+    build(renderer, tex);
+}
+
+SDL_Texture* FlashTints::get(SDL_Renderer* renderer, SDL_Texture* tex, float remaining) {
+    if (remaining <= 0 || !tex) {
+        return tex;
+    }
+
+    const Entry* found = nullptr;
+    for (const Entry& entry : entries) {
+        if (entry.source == tex) {
+            found = &entry;
+            break;
+        }
+    }
+    if (!found) {
+        found = build(renderer, tex);
+    }
+
+    // Round up, so the last moment of a flash still shows a little red
+    int level = static_cast<int>(std::ceil(remaining / hurtFlash::getFlashTime() * LEVELS));
+    if (level < 1) level = 1;
+    if (level > LEVELS) level = LEVELS;
+    return found->tinted[level - 1];
 }
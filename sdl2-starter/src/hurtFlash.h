@@ -1,18 +1,64 @@
 #pragma once
 #include <SDL2/SDL.h>
-#include <unordered_map>
+#include <vector>
 
+// Red tint on whatever was just hit; each World has its own
 class hurtFlash {
 private:
     static constexpr float flashTime = 0.2f; // in seconds
-    std::unordered_map<void*, float> flashingObjects; // Maps object pointer to remaining flash time
-    static hurtFlash* instance;
 
-    hurtFlash() {} // Private constructor for singleton
+    // Object pointer and its remaining flash time. A reserved vector rather than
+    // a map, so a hit in a steady-state frame doesn't allocate a node.
+    struct Flash {
+        void* object;
+        float remaining;
+    };
+    std::vector<Flash> flashingObjects;
 
 public:
-    static hurtFlash* getInstance();
+    hurtFlash();
+
     void update(float deltaTime);
-    SDL_Texture* getFilledImage(SDL_Renderer* renderer, SDL_Texture* tex, void* objectPtr);
     void startFlash(void* objectPtr);
+
+    // Seconds of flash left on the object, 0 when it isn't flashing
+    float getRemaining(void* objectPtr) const;
+
+    // tex tinted for that much flash left, as a new texture the caller destroys;
+    // tex itself when there's none left
+    static SDL_Texture* getFilledImage(SDL_Renderer* renderer, SDL_Texture* tex, float remaining);
+
+    static float getFlashTime() { return flashTime; }
+};
+
+// Tinted copies of sprites, made once per texture and kept, so drawing a flash
+// doesn't read back pixels and create a texture every frame. The tint fades in
+// LEVELS steps instead of continuously. Textures must outlive the cache.
+class FlashTints {
+private:
+    static const int LEVELS = 8;
+
+    struct Entry {
+        SDL_Texture* source;
+        SDL_Texture* tinted[LEVELS];  // tinted[i] is level i + 1, the last one fully red
+    };
+    std::vector<Entry> entries;
+
+    const Entry* build(SDL_Renderer* renderer, SDL_Texture* tex);
+
+public:
+    FlashTints() = default;
+    ~FlashTints();
+
+    FlashTints(const FlashTints&) = delete;
+    FlashTints& operator=(const FlashTints&) = delete;
+
+    // Make every level of tex now, e.g. while loading, so a first flash doesn't
+    void prepare(SDL_Renderer* renderer, SDL_Texture* tex);
+
+    // tex tinted for that much flash left, owned by the cache; tex itself when
+    // there's none left or it can't be tinted
+    SDL_Texture* get(SDL_Renderer* renderer, SDL_Texture* tex, float remaining);
+
+    void clear();
 };
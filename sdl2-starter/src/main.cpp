@@ -7,24 +7,245 @@ Subsequent changes:
 Format: [Author] - [Changes]
 - Added terrain generation and menu state with simple text rendering
 - Added SDL_ttf for font rendering
+- Added --bullet-hell stress scenario (see bench/BulletHellState.h)
+- Added --swarm mode and the --swarm-bench scene (see wasp/WaspSwarm.h)
+- Textures are shared through the AssetManager; --asset-report prints what stayed resident
+- Decoded textures are uploaded a few per frame (AssetManager::pump) instead of all up front
+- Assets come from a memory-mapped assets.pack next to the executable when it exists
+- Added --load-bench, timing PNG against pre-decoded .rgba loading (see bench/LoadBenchState.h)
+- Starts the background Logger; --log-file sends its output to a file instead of stderr
+- Added scenario runs (--wasps/--turtles/--bullets/--rain/--frames/--seed, see bench/ScenarioState.h)
+- Heap allocations are counted per frame (AllocTracker.h); --alloc-report prints them at exit
+- --trace N or F9 captures a frame timeline in Chrome's trace format (Tracer.h)
+- The FlightRecorder keeps the last few seconds and dumps them on a hitch (--hitch-ms)
+- --metrics publishes live metrics to shared memory once a second (tools/metricsreader.cpp)
+- --batch N steps N headless worlds in parallel and reports each (see bench/BatchRunner.h)
+- Gameplay simulates on its own thread while the last tick draws; --no-pipeline turns that off
+- --record-render N or F10 records every draw call for tools/renderreplay.cpp (render/RenderRecorder.h)
+- Sprites are drawn from baked flips and rotations on the software renderer; --sprite-cache / --no-sprite-cache force it
+- --batch takes every game option from the command line, --rain included
+- --batch-verify reruns a batch on one thread and fails if any world's stats differ
+- --bullet-hell-check ramps the bullet hell emitters headless and fails if they miss the target
+- --low-res renders the scene at the art's resolution and scales it up (render/LowResTarget.h)
 *********************************************/
 
 #include <iostream>
+#include <string>
+#include <memory>
+#include <cstdlib>
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_image.h>
 #include <SDL2/SDL_ttf.h>
 #include "GameStateManager.h"
 #include "terrain/MenuState.h"
+#include "bench/BulletHellState.h"
+#include "bench/SwarmBenchState.h"
+#include "bench/LoadBenchState.h"
+#include "bench/ScenarioState.h"
+#include "bench/BatchRunner.h"
+#include "GameOptions.h"
+#include "AssetManager.h"
+#include "AssetPack.h"
+#include "Logger.h"
+#include "Profiler.h"
+#include "AllocTracker.h"
+#include "Tracer.h"
+#include "render/RenderRecorder.h"
+#include "render/LowResTarget.h"
+#include "FlightRecorder.h"
+#include "MetricsPublisher.h"
 
 using namespace std;
 
+static const double ASSET_UPLOAD_BUDGET_MS = 2.0;  // per frame, for textures decoded in the background
+static const int DEFAULT_TRACE_FRAMES = 300;       // what F9 captures without --trace
+static const int DEFAULT_RECORD_FRAMES = 300;      // what F10 records without --record-render
+static const int ART_SCALE = 3;                    // screen pixels per texel: --low-res draws 1280x720 at 427x240
+
 int main(int argc, char* argv[]) {
+    // Command line options for the benchmark scenarios
+    bool bulletHell = false;
+    bool bulletHellCheck = false;
+    bool swarmBench = false;
+    bool loadBench = false;
+    bool scenario = false;
+    bool batch = false;
+    BulletHellConfig bulletHellConfig;
+    SwarmBenchConfig swarmBenchConfig;
+    LoadBenchConfig loadBenchConfig;
+    ScenarioConfig scenarioConfig;
+    BatchConfig batchConfig;
+    GameOptions options;
+    bool assetReport = false;
+    bool allocReport = false;
+    const char* logFile = nullptr;
+    int traceFrames = 0;
+    string traceFile = "trace.json";
+    int recordFrames = 0;
+    string recordFile = "render.frs";
+    int lowResScale = 0;
+    FlightRecorder::Config recorderConfig;
+    bool hitchBudgetSet = false;
+    bool metrics = false;
+    string metricsName = METRICS_DEFAULT_NAME;
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--bullet-hell") {
+            bulletHell = true;
+        } else if (arg == "--bullet-hell-check") {
+            bulletHellCheck = true;
+        } else if (arg == "--emitters" && hasValue) {
+            bulletHellConfig.emitters = atoi(argv[++i]);
+        } else if (arg == "--target-bullets" && hasValue) {
+            bulletHellConfig.targetBullets = atoi(argv[++i]);
+        } else if (arg == "--swarm") {
+            options.swarmMode = true;
+        } else if (arg == "--no-pipeline") {
+            options.pipelined = false;
+        } else if (arg == "--sprite-cache" || arg == "--no-sprite-cache") {
+            // Game or scenario, whichever runs
+            options.spriteCache = (arg == "--sprite-cache") ? 1 : 0;
+            scenarioConfig.spriteCache = options.spriteCache;
+        } else if (arg == "--low-res") {
+            lowResScale = ART_SCALE;
+        } else if (arg == "--low-res-scale" && hasValue) {
+            lowResScale = atoi(argv[++i]);
+        } else if (arg == "--wasps-per-spawn" && hasValue) {
+            options.waspsPerSpawn = atoi(argv[++i]);
+        } else if (arg == "--swarm-bench") {
+            swarmBench = true;
+        } else if (arg == "--wasps" && hasValue) {
+            // Swarm bench or scenario, whichever runs
+            swarmBenchConfig.wasps = atoi(argv[++i]);
+            scenarioConfig.wasps = swarmBenchConfig.wasps;
+        } else if (arg == "--scenario") {
+            scenario = true;
+        } else if (arg == "--turtles" && hasValue) {
+            scenarioConfig.turtles = atoi(argv[++i]);
+            scenario = true;
+        } else if (arg == "--bullets" && hasValue) {
+            scenarioConfig.bullets = atoi(argv[++i]);
+            scenario = true;
+        } else if (arg == "--rain" && hasValue) {
+            // Scenario or batch, whichever runs
+            scenarioConfig.rain = atoi(argv[++i]);
+            batchConfig.options.rainDrops = scenarioConfig.rain;
+            scenario = true;
+        } else if (arg == "--frames" && hasValue) {
+            scenarioConfig.frames = atoi(argv[++i]);
+            scenario = true;
+        } else if (arg == "--seed" && hasValue) {
+            // Scenario or batch, whichever runs
+            scenarioConfig.seed = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+            batchConfig.seed = scenarioConfig.seed;
+            scenario = true;
+        } else if (arg == "--headless") {
+            scenarioConfig.headless = true;
+            scenario = true;
+        } else if (arg == "--json" && hasValue) {
+            scenarioConfig.jsonPath = argv[++i];
+            scenario = true;
+        } else if (arg == "--batch" && hasValue) {
+            batchConfig.worlds = atoi(argv[++i]);
+            batch = true;
+        } else if (arg == "--threads" && hasValue) {
+            batchConfig.threads = atoi(argv[++i]);
+        } else if (arg == "--ticks" && hasValue) {
+            batchConfig.ticks = atoi(argv[++i]);
+        } else if (arg == "--batch-verify") {
+            batchConfig.verify = true;
+        } else if (arg == "--batch-json" && hasValue) {
+            batchConfig.jsonPath = argv[++i];
+        } else if (arg == "--load-bench") {
+            loadBench = true;
+        } else if (arg == "--rounds" && hasValue) {
+            loadBenchConfig.rounds = atoi(argv[++i]);
+        } else if (arg == "--asset-report") {
+            assetReport = true;
+        } else if (arg == "--alloc-report") {
+            allocReport = true;
+        } else if (arg == "--assert-no-alloc") {
+            scenarioConfig.steadyAllocCheck = true;
+            scenario = true;
+        } else if (arg == "--trace" && hasValue) {
+            traceFrames = atoi(argv[++i]);
+        } else if (arg == "--trace-file" && hasValue) {
+            traceFile = argv[++i];
+        } else if (arg == "--record-render" && hasValue) {
+            recordFrames = atoi(argv[++i]);
+        } else if (arg == "--record-file" && hasValue) {
+            recordFile = argv[++i];
+        } else if (arg == "--hitch-ms" && hasValue) {
+            recorderConfig.budgetMs = atof(argv[++i]);
+            hitchBudgetSet = true;
+        } else if (arg == "--hitch-window" && hasValue) {
+            recorderConfig.windowFrames = atoi(argv[++i]);
+        } else if (arg == "--hitch-prefix" && hasValue) {
+            recorderConfig.prefix = argv[++i];
+        } else if (arg == "--metrics") {
+            metrics = true;
+        } else if (arg == "--metrics-name" && hasValue) {
+            metrics = true;
+            metricsName = argv[++i];
+        } else if (arg == "--log-file" && hasValue) {
+            logFile = argv[++i];
+        } else {
+            cout << "Unknown option: " << arg << endl;
+        }
+    }
+    int exitCode = 0;
+
+    // Game code logs through LOG_* (Logger.h); this thread does the writing
+    Logger::getInstance()->start(logFile);
+    Tracer::getInstance()->setThreadName("main");
+
+    // The bullet hell ramp on its own, to check the emitters still reach the target
+    if (bulletHellCheck) {
+        int peak = 0;
+        bool reached = BulletHellState::rampReachesTarget(bulletHellConfig, peak);
+        cout << "Bullet hell ramp: peak " << peak << " live bullets, target " << bulletHellConfig.targetBullets
+             << (reached ? " reached" : " not reached") << endl;
+        Logger::getInstance()->stop();
+        return reached ? 0 : 1;
+    }
+
+    // Batch runs simulate without SDL's video, images or fonts, so they're done before any of it starts
+    if (batch) {
+        // Every game option from the command line; rain keeps the batch's own default
+        int rainDrops = batchConfig.options.rainDrops;
+        batchConfig.options = options;
+        batchConfig.options.rainDrops = rainDrops;
+        exitCode = BatchRunner(batchConfig).run();
+        Logger::getInstance()->stop();
+        return exitCode;
+    }
+
+    // Headless scenario runs need no display (or sound card)
+    if (scenario && scenarioConfig.headless) {
+        SDL_setenv("SDL_VIDEODRIVER", "dummy", 1);
+        SDL_setenv("SDL_AUDIODRIVER", "dummy", 1);
+    }
+
+    // Count SDL's allocations with ours; has to happen before SDL allocates anything
+    AllocTracker::hookSDL();
+
     // Initialize SDL and other systems
     if (SDL_Init(SDL_INIT_EVERYTHING) < 0) {
         cout << "SDL could not initialize! SDL_Error: " << SDL_GetError() << endl;
         return 1;
     }
 
+    // One mapped file for every asset if the build packed them (see tools/packassets.cpp),
+    // otherwise the loose assets/ and fonts/ files
+    char* basePath = SDL_GetBasePath();
+    string packPath = string(basePath ? basePath : "") + "assets.pack";
+    SDL_free(basePath);
+    AssetPack* pack = AssetPack::getInstance();
+    if (pack->open(packPath) || pack->open("assets.pack")) {
+        cout << "Using " << pack->getPath() << " (" << pack->getEntryCount() << " assets)" << endl;
+    }
+
     // Initialize SDL_image with PNG support
     int imgFlags = IMG_INIT_PNG;
     if ((IMG_Init(imgFlags) & imgFlags) != imgFlags) {
@@ -53,9 +274,13 @@ int main(int argc, char* argv[]) {
         return 1;
     }
 
-    // initialize renderer with hardware acceleration and vsync
-    SDL_Renderer* renderer = SDL_CreateRenderer(window, -1, 
-        SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
+    // initialize renderer with hardware acceleration and vsync. Scenario runs skip
+    // vsync so frame times show the work, and headless ones only have the software renderer
+    Uint32 rendererFlags = SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC;
+    if (scenario) {
+        rendererFlags = scenarioConfig.headless ? SDL_RENDERER_SOFTWARE : SDL_RENDERER_ACCELERATED;
+    }
+    SDL_Renderer* renderer = SDL_CreateRenderer(window, -1, rendererFlags);
     if (!renderer) {
         cout << "Renderer could not be created! SDL_Error: " << SDL_GetError() << endl;
         SDL_DestroyWindow(window);
@@ -67,12 +292,43 @@ int main(int argc, char* argv[]) {
 
     try {
         GameStateManager stateManager;
-        stateManager.PushState(new MenuState(stateManager));
+        std::unique_ptr<LowResTarget> lowRes;  // Goes before the renderer does
+        if (lowResScale > 1) {
+            lowRes = std::make_unique<LowResTarget>(lowResScale);
+        }
+        if (bulletHell) {
+            stateManager.PushState(new BulletHellState(bulletHellConfig, exitCode));
+        } else if (swarmBench) {
+            stateManager.PushState(new SwarmBenchState(swarmBenchConfig, exitCode));
+        } else if (loadBench) {
+            stateManager.PushState(new LoadBenchState(loadBenchConfig, exitCode));
+        } else if (scenario) {
+            stateManager.PushState(new ScenarioState(stateManager, scenarioConfig, exitCode));
+        } else {
+            stateManager.PushState(new MenuState(stateManager, options));
+        }
 
         bool isRunning = true;
         SDL_Event event;
         Uint32 lastTime = SDL_GetTicks();
 
+        // --trace captures from the first frame; F9 captures from whenever it's pressed
+        if (traceFrames > 0) {
+            Tracer::getInstance()->start(traceFrames, traceFile);
+        }
+        if (recordFrames > 0) {
+            RenderRecorder::getInstance()->start(recordFrames, recordFile);
+        }
+
+        // Hitch dumps in normal play; benchmarks are slow on purpose, so only when asked
+        bool benchmark = bulletHell || swarmBench || loadBench || scenario;
+        if (!benchmark || hitchBudgetSet) {
+            FlightRecorder::getInstance()->start(recorderConfig);
+        }
+        if (metrics) {
+            MetricsPublisher::getInstance()->start(metricsName);
+        }
+
         while (isRunning) {
             // Calculate delta time
             Uint32 currentTime = SDL_GetTicks();
@@ -84,23 +340,72 @@ int main(int argc, char* argv[]) {
                 if (event.type == SDL_QUIT) {
                     isRunning = false;
                 }
+                if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_F9 && !event.key.repeat) {
+                    Tracer::getInstance()->start(traceFrames > 0 ? traceFrames : DEFAULT_TRACE_FRAMES, traceFile);
+                }
+                if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_F10 && !event.key.repeat) {
+                    RenderRecorder::getInstance()->start(recordFrames > 0 ? recordFrames : DEFAULT_RECORD_FRAMES,
+                                                         recordFile);
+                }
+                FlightRecorder::getInstance()->recordEvent(event);
                 stateManager.HandleEvents(event);
             }
 
             // Update and render
-            stateManager.Update(deltaTime);
+            {
+                TRACE_SCOPE("update");
+                stateManager.Update(deltaTime);
+            }
+
+            // Upload whatever the decode workers finished, within a slice of the frame
+            {
+                TRACE_SCOPE("asset.upload");
+                AssetManager::getInstance()->pump(renderer, ASSET_UPLOAD_BUDGET_MS);
+            }
 
             // Clear screen with black background
-            SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-            SDL_RenderClear(renderer);
-            stateManager.Render(renderer);
-            SDL_RenderPresent(renderer);
+            {
+                TRACE_SCOPE("render");
+                RenderRecorder::getInstance()->beginFrame(renderer);
+                // The low-res pass clears its own texture, and the upscale covers the window
+                bool lowResFrame = lowRes && lowRes->begin(renderer);
+                if (!lowResFrame) {
+                    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+                    Draw::clear(renderer);
+                }
+                stateManager.Render(renderer);
+                if (lowResFrame) {
+                    lowRes->end(renderer);
+                }
+                stateManager.RenderHUD(renderer);
+                RenderRecorder::getInstance()->endFrame();
+            }
+            {
+                TRACE_SCOPE("present");
+                SDL_RenderPresent(renderer);
+            }
+            AllocTracker::endFrame();
+            MetricsPublisher::getInstance()->endFrame();
+            Tracer::getInstance()->endFrame();
+            FlightRecorder::getInstance()->endFrame();  // Reads the profiler's frame, so before it closes
+            Profiler::getInstance()->endFrame();
         }
     }
     catch (const std::exception& e) {
         cout << "Error occurred: " << e.what() << endl;
     }
 
+    // Cached textures have to go while the renderer still exists
+    if (allocReport) {
+        AllocTracker::printReport(cout);
+    }
+    if (assetReport) {
+        AssetManager::getInstance()->logReport();
+    }
+    MetricsPublisher::getInstance()->stop();  // Removes the segment so readers see the game is gone
+    AssetManager::getInstance()->clear();
+    AssetPack::getInstance()->close();  // Nothing reads from the mapping any more
+
     // Clean up in reverse order of creation
     SDL_DestroyRenderer(renderer);
     SDL_DestroyWindow(window);
@@ -108,5 +413,6 @@ int main(int argc, char* argv[]) {
     IMG_Quit();
     SDL_Quit();
 
-    return 0;
+    Logger::getInstance()->stop();  // Flushes whatever is still queued
+    return exitCode;
 }
@@ -0,0 +1,138 @@
+#include "ParticleSystem.h"
+#include <limits>
+
+ParticlePool::ParticlePool(int capacity, ParticleShape s)
+    : maxParticles(capacity), count(0), shape(s), texture(nullptr), spriteCache(nullptr),
+      color({255, 255, 255, 255}), gravity(0.0f),
+      killY(std::numeric_limits<float>::max()), streakScale(0.0f), fadeOut(true) {
+    // Size every array once; nothing below this point grows them
+    x.resize(maxParticles);
+    y.resize(maxParticles);
+    velocityX.resize(maxParticles);
+    velocityY.resize(maxParticles);
+    lifetime.resize(maxParticles);
+    invMaxLifetime.resize(maxParticles);
+    width.resize(maxParticles);
+    height.resize(maxParticles);
+    growth.resize(maxParticles);
+    rotation.resize(maxParticles);
+    spin.resize(maxParticles);
+    startAlpha.resize(maxParticles);
+}
+
+bool ParticlePool::emit(const ParticleParams& params) {
+    if (count >= maxParticles || params.lifetime <= 0.0f) return false;
+
+    int i = count++;
+    x[i] = params.x;
+    y[i] = params.y;
+    velocityX[i] = params.velocityX;
+    velocityY[i] = params.velocityY;
+    lifetime[i] = params.lifetime;
+    invMaxLifetime[i] = 1.0f / params.lifetime;
+    width[i] = params.width;
+    height[i] = params.height;
+    growth[i] = params.growth;
+    rotation[i] = params.rotation;
+    spin[i] = params.spin;
+    startAlpha[i] = params.alpha;
+    return true;
+}
+
+void ParticlePool::swapRemove(int i) {
+    // Move the last live particle into the dead slot
+    int last = --count;
+    x[i] = x[last];
+    y[i] = y[last];
+    velocityX[i] = velocityX[last];
+    velocityY[i] = velocityY[last];
+    lifetime[i] = lifetime[last];
+    invMaxLifetime[i] = invMaxLifetime[last];
+    width[i] = width[last];
+    height[i] = height[last];
+    growth[i] = growth[last];
+    rotation[i] = rotation[last];
+    spin[i] = spin[last];
+    startAlpha[i] = startAlpha[last];
+}
+
+void ParticlePool::update(float deltaTime) {
+    const int n = count;
+    const float gravityStep = gravity * deltaTime;
+
+    // Integrate every particle in straight loops over the arrays
+    for (int i = 0; i < n; i++) {
+        velocityY[i] += gravityStep;
+        x[i] += velocityX[i] * deltaTime;
+        y[i] += velocityY[i] * deltaTime;
+        lifetime[i] -= deltaTime;
+    }
+    for (int i = 0; i < n; i++) {
+        width[i] += growth[i] * deltaTime;
+        height[i] += growth[i] * deltaTime;
+        rotation[i] += spin[i] * deltaTime;
+    }
+
+    // Remove expired particles; don't advance i after a swap so the moved one is checked too
+    for (int i = 0; i < count; ) {
+        if (lifetime[i] <= 0.0f || y[i] > killY) {
+            swapRemove(i);
+        } else {
+            ++i;
+        }
+    }
+}
+
+void ParticlePool::render(SDL_Renderer* renderer, QuadBatch& batch) const {
+    if (count == 0) return;
+    if (shape == ParticleShape::SPRITE && !texture) return;
+
+    // Sprites from the cache are straight quads cut from one atlas of baked rotations
+    int sprite = -1;
+    SpriteCache::Cell cell;
+    if (shape == ParticleShape::SPRITE && spriteCache) {
+        sprite = spriteCache->getSprite(renderer, texture, nullptr,
+                                        static_cast<int>(width[0] + 0.5f), static_cast<int>(height[0] + 0.5f));
+    }
+    bool cached = sprite >= 0 && spriteCache->getCell(sprite, 0.0, SDL_FLIP_NONE, cell);
+
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    batch.begin(renderer, cached ? cell.atlas : (shape == ParticleShape::SPRITE ? texture : nullptr));
+
+    SDL_Color c = color;
+    for (int i = 0; i < count; i++) {
+        float alpha = fadeOut ? startAlpha[i] * lifetime[i] * invMaxLifetime[i] : startAlpha[i];
+        c.a = static_cast<Uint8>(alpha < 0.0f ? 0.0f : alpha);
+
+        switch (shape) {
+            case ParticleShape::QUAD:
+                batch.addRect(x[i] - width[i] / 2, y[i] - height[i] / 2, width[i], height[i], c);
+                break;
+            case ParticleShape::STREAK:
+                batch.addLine(x[i], y[i],
+                              x[i] + velocityX[i] * streakScale,
+                              y[i] + velocityY[i] * streakScale,
+                              width[i], c);
+                break;
+            case ParticleShape::SPRITE:
+                if (cached) {
+                    spriteCache->getCell(sprite, rotation[i], SDL_FLIP_NONE, cell);
+                    float w = width[i] * cell.scaleX;
+                    float h = height[i] * cell.scaleY;
+                    batch.addRectUV(x[i] - w / 2, y[i] - h / 2, w, h, cell.u0, cell.v0, cell.u1, cell.v1, c);
+                } else if (rotation[i] == 0.0f) {
+                    batch.addRect(x[i] - width[i] / 2, y[i] - height[i] / 2, width[i], height[i], c);
+                } else {
+                    batch.addRotated(x[i], y[i], width[i], height[i], rotation[i], c);
+                }
+                break;
+        }
+    }
+
+    batch.end();
+}
+
+size_t ParticlePool::memoryBytes() const {
+    // 11 float arrays plus the alpha bytes
+    return static_cast<size_t>(maxParticles) * (11 * sizeof(float) + sizeof(Uint8));
+}
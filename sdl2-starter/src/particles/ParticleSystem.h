@@ -0,0 +1,104 @@
+#ifndef PARTICLE_SYSTEM_H
+#define PARTICLE_SYSTEM_H
+
+#include <SDL2/SDL.h>
+#include <vector>
+#include "../render/QuadBatch.h"
+#include "../render/SpriteCache.h"
+
+// How a pool draws its particles
+enum class ParticleShape {
+    QUAD,    // flat coloured square centered on the particle
+    STREAK,  // line from the particle along its velocity (rain)
+    SPRITE   // textured quad, optionally rotated
+};
+
+// Everything needed to spawn one particle
+struct ParticleParams {
+    float x = 0.0f, y = 0.0f;
+    float velocityX = 0.0f, velocityY = 0.0f;
+    float lifetime = 1.0f;         // in seconds
+    float width = 1.0f, height = 1.0f;
+    float growth = 0.0f;           // pixels per second added to width and height
+    float rotation = 0.0f;         // degrees
+    float spin = 0.0f;             // degrees per second
+    Uint8 alpha = 255;             // alpha at spawn; fades to 0 over the lifetime if enabled
+};
+
+// A fixed-capacity pool of particles stored as parallel arrays (SoA).
+// All storage is allocated in the constructor: emitting past capacity drops the
+// particle instead of growing, dead particles are swap-removed, and rendering
+// goes through a preallocated QuadBatch, so the steady state never allocates.
+class ParticlePool {
+private:
+    int maxParticles;
+    int count;
+
+    // Per-particle data, one array per field
+    std::vector<float> x, y;
+    std::vector<float> velocityX, velocityY;
+    std::vector<float> lifetime, invMaxLifetime;
+    std::vector<float> width, height, growth;
+    std::vector<float> rotation, spin;
+    std::vector<Uint8> startAlpha;
+
+    // Pool-wide settings shared by every particle
+    ParticleShape shape;
+    SDL_Texture* texture;
+    SpriteCache* spriteCache;   // SPRITE particles drawn from baked rotations when set
+    SDL_Color color;
+    float gravity;        // added to velocityY every second
+    float killY;          // particles below this line die early
+    float streakScale;    // STREAK length = velocity * streakScale
+    bool fadeOut;
+
+    void swapRemove(int i);
+
+public:
+    ParticlePool(int capacity, ParticleShape shape);
+
+    // Returns false (and drops the particle) when the pool is full
+    bool emit(const ParticleParams& params);
+    void update(float deltaTime);
+    void render(SDL_Renderer* renderer, QuadBatch& batch) const;
+    void clear() { count = 0; }
+
+    void setTexture(SDL_Texture* tex) { texture = tex; }
+    // Needs a cache with rotations; the sprite is baked at the first particle's size
+    void setSpriteCache(SpriteCache* cache) { spriteCache = cache; }
+    void setColor(Uint8 r, Uint8 g, Uint8 b) { color = {r, g, b, 255}; }
+    void setGravity(float g) { gravity = g; }
+    void setKillY(float yLimit) { killY = yLimit; }
+    void setStreakScale(float scale) { streakScale = scale; }
+    void setFadeOut(bool fade) { fadeOut = fade; }
+
+    int size() const { return count; }
+    int capacity() const { return maxParticles; }
+    bool full() const { return count >= maxParticles; }
+
+    // Upper bound on the memory this pool will ever use
+    size_t memoryBytes() const;
+};
+
+// Turns a continuous rate into a whole number of spawns per tick,
+// carrying the fractional remainder over to the next tick
+class ParticleEmitter {
+private:
+    float rate;         // spawns per second
+    float accumulator;
+
+public:
+    explicit ParticleEmitter(float ratePerSecond = 0.0f) : rate(ratePerSecond), accumulator(0.0f) {}
+
+    int due(float deltaTime) {
+        accumulator += rate * deltaTime;
+        int spawns = static_cast<int>(accumulator);
+        accumulator -= spawns;
+        return spawns;
+    }
+
+    void setRate(float ratePerSecond) { rate = ratePerSecond; }
+    void reset() { accumulator = 0.0f; }
+};
+
+#endif // PARTICLE_SYSTEM_H
@@ -0,0 +1,70 @@
+#include "BackgroundLayer.h"
+#include "RenderRecorder.h"
+#include "RenderTargetScope.h"
+#include "../terrain/TerrainGrid.h"
+#include "../terrainElem.h"
+#include "../Logger.h"
+
+BackgroundLayer::BackgroundLayer(int width, int height)
+    : texture(nullptr), width(width), height(height), failed(false), baked(false),
+      bakedTerrain(nullptr), bakedElements(nullptr), terrainVersion(0), elementsVersion(0) {}
+
+BackgroundLayer::~BackgroundLayer() {
+    if (texture) {
+        SDL_DestroyTexture(texture);
+    }
+}
+
+bool BackgroundLayer::bake(SDL_Renderer* renderer, TerrainGrid* terrain, terrainElements* elements) {
+    RenderTargetScope target(renderer, texture);
+    if (!target.isActive()) {
+        LOG_WARN("Can't draw into the background layer, drawing its layers each frame: %s", SDL_GetError());
+        return false;
+    }
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+    Draw::clear(renderer);
+    terrain->render(renderer);  // Rebuilds the terrain's own texture first if it changed
+    if (elements) {
+        elements->render();
+    }
+
+    baked = true;
+    bakedTerrain = terrain;
+    bakedElements = elements;
+    terrainVersion = terrain->getVersion();
+    elementsVersion = elements ? elements->getVersion() : 0;
+    LOG_DEBUG("Baked the background layer (terrain v%u, elements v%u)", terrainVersion, elementsVersion);
+    return true;
+}
+
+void BackgroundLayer::render(SDL_Renderer* renderer, TerrainGrid* terrain, terrainElements* elements) {
+    if (!terrain) return;
+
+    if (!texture && !failed) {
+        texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, width, height);
+        if (texture) {
+            SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_NONE);  // Opaque; the first thing drawn each frame
+        } else {
+            LOG_WARN("Can't cache the background, drawing its layers each frame: %s", SDL_GetError());
+            failed = true;
+        }
+    }
+
+    bool stale = !baked || terrain != bakedTerrain || elements != bakedElements ||
+                 terrain->getVersion() != terrainVersion ||
+                 (elements && elements->getVersion() != elementsVersion);
+    if (texture && stale && !bake(renderer, terrain, elements)) {
+        SDL_DestroyTexture(texture);
+        texture = nullptr;
+        failed = true;
+    }
+    if (texture) {
+        Draw::copy(renderer, texture, nullptr, nullptr);
+        return;
+    }
+
+    terrain->render(renderer);
+    if (elements) {
+        elements->render();
+    }
+}
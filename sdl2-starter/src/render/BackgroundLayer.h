@@ -0,0 +1,45 @@
+#ifndef BACKGROUND_LAYER_H
+#define BACKGROUND_LAYER_H
+
+#include <SDL2/SDL.h>
+#include <cstdint>
+
+class TerrainGrid;
+class terrainElements;
+
+// The static layers of the scene, terrain cells then the cattails, stones and
+// lilypads on them, composited into one render target so the background is a
+// single copy a frame instead of a hundred. The bake is keyed by the terrain's
+// and the elements' version counters: a regenerated map, a moved threshold or
+// new colors bumps one, and the next render() redraws the layers. Everything that moves
+// (water rings, rain, entities, the HUD) is drawn on top as before.
+//
+// Falls back to drawing the layers directly if the renderer has no target
+// textures. Main thread only.
+class BackgroundLayer {
+private:
+    SDL_Texture* texture;
+    int width, height;
+    bool failed;            // couldn't create the target; don't retry every frame
+
+    // What the texture holds
+    bool baked;
+    const TerrainGrid* bakedTerrain;
+    const terrainElements* bakedElements;
+    uint32_t terrainVersion;
+    uint32_t elementsVersion;
+
+    bool bake(SDL_Renderer* renderer, TerrainGrid* terrain, terrainElements* elements);
+
+public:
+    BackgroundLayer(int width, int height);
+    ~BackgroundLayer();
+
+    BackgroundLayer(const BackgroundLayer&) = delete;
+    BackgroundLayer& operator=(const BackgroundLayer&) = delete;
+
+    // Draws the terrain with its elements on top; elements may be null
+    void render(SDL_Renderer* renderer, TerrainGrid* terrain, terrainElements* elements);
+};
+
+#endif // BACKGROUND_LAYER_H
@@ -0,0 +1,57 @@
+#include "LowResTarget.h"
+#include "RenderRecorder.h"
+#include "../Logger.h"
+
+LowResTarget::LowResTarget(int scale)
+    : scale(scale < 1 ? 1 : scale), texture(nullptr), width(0), height(0), failed(false), drawing(false) {}
+
+LowResTarget::~LowResTarget() {
+    if (texture) {
+        SDL_DestroyTexture(texture);
+    }
+}
+
+bool LowResTarget::begin(SDL_Renderer* renderer) {
+    if (failed) return false;
+
+    int outputWidth, outputHeight;
+    if (SDL_GetRendererOutputSize(renderer, &outputWidth, &outputHeight) != 0) return false;
+    int w = (outputWidth + scale - 1) / scale;
+    int h = (outputHeight + scale - 1) / scale;
+
+    if (!texture || w != width || h != height) {
+        if (texture) {
+            SDL_DestroyTexture(texture);
+        }
+        texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, w, h);
+        if (!texture) {
+            LOG_WARN("Can't render at %dx%d, drawing at full resolution: %s", w, h, SDL_GetError());
+            failed = true;
+            return false;
+        }
+        // The scene is opaque, so the upscale is a straight copy with hard pixel edges
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_NONE);
+        SDL_SetTextureScaleMode(texture, SDL_ScaleModeNearest);
+        width = w;
+        height = h;
+        LOG_INFO("Rendering the scene at %dx%d, scaled up %dx", width, height, scale);
+    }
+
+    if (Draw::setTarget(renderer, texture) != 0) return false;
+    // After the target: SDL resets the scale whenever it changes
+    Draw::setScale(renderer, 1.0f / scale, 1.0f / scale);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+    Draw::clear(renderer);
+    drawing = true;
+    return true;
+}
+
+void LowResTarget::end(SDL_Renderer* renderer) {
+    if (!drawing) return;
+    drawing = false;
+
+    // Back on the window its own scale comes back with it; a rounded-up texture overhangs the edge
+    Draw::setTarget(renderer, nullptr);
+    SDL_Rect dst = {0, 0, width * scale, height * scale};
+    Draw::copy(renderer, texture, nullptr, &dst);
+}
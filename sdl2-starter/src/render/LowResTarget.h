@@ -0,0 +1,34 @@
+#ifndef LOW_RES_TARGET_H
+#define LOW_RES_TARGET_H
+
+#include <SDL2/SDL.h>
+
+// Renders the scene at the art's own resolution and scales it up whole. Every
+// sprite is 16px art drawn 3x, so at 1280x720 the renderer fills nine screen
+// pixels per texel; begin() points drawing at a texture 1/scale the size of the
+// output (427x240 for 3) with SDL's render scale set to match, so the states
+// keep drawing in window coordinates. end() goes back to the window with one
+// nearest-neighbour copy. Anything drawn after that (GameState::RenderHUD) is
+// at full resolution, which keeps text readable.
+class LowResTarget {
+private:
+    int scale;
+    SDL_Texture* texture;
+    int width, height;      // the output's size over scale, rounded up
+    bool failed;            // no target textures on this renderer; don't retry every frame
+    bool drawing;           // between begin() and end()
+
+public:
+    explicit LowResTarget(int scale);
+    ~LowResTarget();
+
+    LowResTarget(const LowResTarget&) = delete;
+    LowResTarget& operator=(const LowResTarget&) = delete;
+
+    // Clears the texture and draws into it; false if it can't, and then
+    // drawing goes straight to the window as usual
+    bool begin(SDL_Renderer* renderer);
+    void end(SDL_Renderer* renderer);
+};
+
+#endif // LOW_RES_TARGET_H
@@ -0,0 +1,142 @@
+#ifndef QUAD_BATCH_H
+#define QUAD_BATCH_H
+
+#include "RenderRecorder.h"
+#include <SDL2/SDL.h>
+#include <vector>
+#include <cmath>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// Collects quads that share one texture (or no texture) and submits them with a
+// single SDL_RenderGeometry call. Vertex and index storage is sized once in the
+// constructor, so adding quads never allocates.
+class QuadBatch {
+private:
+    std::vector<SDL_Vertex> vertices;
+    std::vector<int> indices;
+    int maxQuads;
+    int quadCount;
+    SDL_Renderer* renderer;
+    SDL_Texture* texture;
+    int vertexCursor;  // Next vertex of the quad being written
+
+    void push(float x, float y, float u, float v, SDL_Color color) {
+        SDL_Vertex& vert = vertices[quadCount * 4 + (vertexCursor++)];
+        vert.position = {x, y};
+        vert.color = color;
+        vert.tex_coord = {u, v};
+    }
+
+    void reserveQuad() {
+        if (quadCount >= maxQuads) {
+            flush();
+        }
+        vertexCursor = 0;
+    }
+
+public:
+    explicit QuadBatch(int capacity)
+        : maxQuads(capacity), quadCount(0), renderer(nullptr), texture(nullptr), vertexCursor(0) {
+        vertices.resize(maxQuads * 4);
+        indices.resize(maxQuads * 6);
+
+        // The index pattern never changes, so build it once up front
+        for (int i = 0; i < maxQuads; i++) {
+            indices[i * 6 + 0] = i * 4 + 0;
+            indices[i * 6 + 1] = i * 4 + 1;
+            indices[i * 6 + 2] = i * 4 + 2;
+            indices[i * 6 + 3] = i * 4 + 2;
+            indices[i * 6 + 4] = i * 4 + 3;
+            indices[i * 6 + 5] = i * 4 + 0;
+        }
+    }
+
+    // Start a batch; pass nullptr as the texture for flat-coloured quads
+    void begin(SDL_Renderer* rend, SDL_Texture* tex) {
+        renderer = rend;
+        texture = tex;
+        quadCount = 0;
+    }
+
+    // Axis-aligned quad
+    void addRect(float x, float y, float w, float h, SDL_Color color) {
+        reserveQuad();
+        push(x, y, 0.0f, 0.0f, color);
+        push(x + w, y, 1.0f, 0.0f, color);
+        push(x + w, y + h, 1.0f, 1.0f, color);
+        push(x, y + h, 0.0f, 1.0f, color);
+        quadCount++;
+    }
+
+    // Axis-aligned quad showing the (u0, v0) - (u1, v1) part of the texture, e.g. an
+    // atlas cell. The software renderer draws quads like this as plain copies.
+    void addRectUV(float x, float y, float w, float h, float u0, float v0, float u1, float v1, SDL_Color color) {
+        reserveQuad();
+        push(x, y, u0, v0, color);
+        push(x + w, y, u1, v0, color);
+        push(x + w, y + h, u1, v1, color);
+        push(x, y + h, u0, v1, color);
+        quadCount++;
+    }
+
+    // Quad of size w x h centered on (cx, cy), rotated clockwise by angle degrees
+    void addRotated(float cx, float cy, float w, float h, float angle, SDL_Color color) {
+        float radians = angle * static_cast<float>(M_PI) / 180.0f;
+        float c = std::cos(radians);
+        float s = std::sin(radians);
+        float hw = w * 0.5f;
+        float hh = h * 0.5f;
+
+        reserveQuad();
+        push(cx + (-hw * c - -hh * s), cy + (-hw * s + -hh * c), 0.0f, 0.0f, color);
+        push(cx + ( hw * c - -hh * s), cy + ( hw * s + -hh * c), 1.0f, 0.0f, color);
+        push(cx + ( hw * c -  hh * s), cy + ( hw * s +  hh * c), 1.0f, 1.0f, color);
+        push(cx + (-hw * c -  hh * s), cy + (-hw * s +  hh * c), 0.0f, 1.0f, color);
+        quadCount++;
+    }
+
+    // Line segment drawn as a quad of the given thickness
+    void addLine(float x0, float y0, float x1, float y1, float thickness, SDL_Color color) {
+        float dx = x1 - x0;
+        float dy = y1 - y0;
+        float length = std::sqrt(dx * dx + dy * dy);
+        if (length <= 0.0f) return;
+
+        // Perpendicular offset for the line's thickness
+        float px = -dy / length * thickness * 0.5f;
+        float py = dx / length * thickness * 0.5f;
+
+        reserveQuad();
+        push(x0 + px, y0 + py, 0.0f, 0.0f, color);
+        push(x1 + px, y1 + py, 1.0f, 0.0f, color);
+        push(x1 - px, y1 - py, 1.0f, 1.0f, color);
+        push(x0 - px, y0 - py, 0.0f, 1.0f, color);
+        quadCount++;
+    }
+
+    // Submit everything queued so far in one draw call
+    void flush() {
+        if (quadCount > 0 && renderer) {
+            Draw::geometry(renderer, texture, vertices.data(), quadCount * 4,
+                           indices.data(), quadCount * 6);
+        }
+        quadCount = 0;
+    }
+
+    void end() {
+        flush();
+        renderer = nullptr;
+        texture = nullptr;
+    }
+
+    int capacity() const { return maxQuads; }
+
+    size_t memoryBytes() const {
+        return vertices.capacity() * sizeof(SDL_Vertex) + indices.capacity() * sizeof(int);
+    }
+};
+
+#endif // QUAD_BATCH_H
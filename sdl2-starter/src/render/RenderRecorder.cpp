@@ -0,0 +1,261 @@
+#include "RenderRecorder.h"
+#include "../Logger.h"
+#include <cstdio>
+#include <cstring>
+
+static const size_t COMMANDS_PER_FRAME = 512;  // reserved per captured frame
+
+bool RenderRecorder::recording = false;
+RenderRecorder* RenderRecorder::instance = nullptr;
+
+RenderRecorder* RenderRecorder::getInstance() {
+    if (instance == nullptr) {
+        instance = new RenderRecorder();
+    }
+    return instance;
+}
+
+RenderRecorder::RenderRecorder()
+    : framesLeft(0), width(0), height(0), frameCommands(0), frameVertices(0), frameIndices(0), frameStart(0) {}
+
+void RenderRecorder::start(int frameCount, const std::string& outputPath) {
+    if (framesLeft > 0 || frameCount <= 0) return;
+
+    commands.clear();
+    vertices.clear();
+    indices.clear();
+    frames.clear();
+    textures.clear();
+    textureIds.clear();
+    commands.reserve(static_cast<size_t>(frameCount) * COMMANDS_PER_FRAME);
+    frames.reserve(frameCount);
+    framesLeft = frameCount;
+    width = 0;
+    height = 0;
+    path = outputPath;
+    LOG_INFO("Recording render commands for %d frames to %s", frameCount, path.c_str());
+}
+
+void RenderRecorder::beginFrame(SDL_Renderer* renderer) {
+    if (framesLeft <= 0) return;
+    if (frames.empty()) {
+        SDL_GetRendererOutputSize(renderer, &width, &height);
+    }
+    frameCommands = commands.size();
+    frameVertices = vertices.size();
+    frameIndices = indices.size();
+    frameStart = SDL_GetPerformanceCounter();
+    recording = true;
+}
+
+void RenderRecorder::endFrame() {
+    if (!recording) return;
+    recording = false;
+
+    RenderStreamFrame frame;
+    frame.commandCount = static_cast<uint32_t>(commands.size() - frameCommands);
+    frame.vertexCount = static_cast<uint32_t>(vertices.size() - frameVertices);
+    frame.indexCount = static_cast<uint32_t>(indices.size() - frameIndices);
+    frame.renderMs = static_cast<float>((SDL_GetPerformanceCounter() - frameStart) * 1000.0 /
+                                        SDL_GetPerformanceFrequency());
+    frames.push_back(frame);
+
+    if (--framesLeft == 0) {
+        if (!write()) {
+            LOG_ERROR("Couldn't write render commands to %s", path.c_str());
+        }
+        // A capture can be large; give the memory back
+        std::vector<RenderCommand>().swap(commands);
+        std::vector<RenderStreamVertex>().swap(vertices);
+        std::vector<int32_t>().swap(indices);
+    }
+}
+
+int RenderRecorder::textureId(SDL_Texture* texture) {
+    if (!texture) return -1;
+
+    RenderStreamTexture shape = {};
+    int access = 0;
+    SDL_QueryTexture(texture, &shape.format, &access, &shape.width, &shape.height);
+    shape.access = access;
+
+    auto found = textureIds.find(texture);
+    if (found != textureIds.end()) {
+        const RenderStreamTexture& known = textures[found->second];
+        if (known.width == shape.width && known.height == shape.height &&
+            known.format == shape.format && known.access == shape.access) {
+            return found->second;
+        }
+        // Otherwise it was destroyed and its address reused: a new texture
+    }
+    int id = static_cast<int>(textures.size());
+    textures.push_back(shape);
+    textureIds[texture] = id;
+    return id;
+}
+
+RenderCommand& RenderRecorder::push(RenderOp op) {
+    RenderCommand command;
+    std::memset(&command, 0, sizeof(command));
+    command.op = op;
+    command.texture = -1;
+    command.src[2] = -1.0f;
+    command.dst[2] = -1.0f;
+    commands.push_back(command);
+    return commands.back();
+}
+
+void RenderRecorder::rendererState(SDL_Renderer* renderer, RenderCommand& command) {
+    SDL_GetRenderDrawColor(renderer, &command.color[0], &command.color[1], &command.color[2], &command.color[3]);
+    SDL_BlendMode blend = SDL_BLENDMODE_NONE;
+    SDL_GetRenderDrawBlendMode(renderer, &blend);
+    command.blend = static_cast<uint32_t>(blend);
+}
+
+void RenderRecorder::textureState(SDL_Texture* texture, RenderCommand& command) {
+    command.texture = textureId(texture);
+    SDL_GetTextureColorMod(texture, &command.color[0], &command.color[1], &command.color[2]);
+    SDL_GetTextureAlphaMod(texture, &command.color[3]);
+    SDL_BlendMode blend = SDL_BLENDMODE_NONE;
+    SDL_GetTextureBlendMode(texture, &blend);
+    command.blend = static_cast<uint32_t>(blend);
+}
+
+void RenderRecorder::copy(SDL_Renderer*, SDL_Texture* texture, const SDL_Rect* src, const SDL_FRect* dst,
+                          double angle, const SDL_FPoint* center, SDL_RendererFlip flip) {
+    if (!texture) return;  // SDL refuses it too
+    RenderCommand& command = push(RENDER_OP_COPY);
+    textureState(texture, command);
+    if (src) {
+        command.src[0] = static_cast<float>(src->x);
+        command.src[1] = static_cast<float>(src->y);
+        command.src[2] = static_cast<float>(src->w);
+        command.src[3] = static_cast<float>(src->h);
+    }
+    if (dst) {
+        command.dst[0] = dst->x;
+        command.dst[1] = dst->y;
+        command.dst[2] = dst->w;
+        command.dst[3] = dst->h;
+    }
+    if (center) {
+        command.hasCenter = 1;
+        command.center[0] = center->x;
+        command.center[1] = center->y;
+    }
+    command.angle = static_cast<float>(angle);
+    command.flip = static_cast<uint8_t>(flip);
+}
+
+void RenderRecorder::fillRect(SDL_Renderer* renderer, const SDL_FRect* rect) {
+    RenderCommand& command = push(RENDER_OP_FILL_RECT);
+    rendererState(renderer, command);
+    if (rect) {
+        command.dst[0] = rect->x;
+        command.dst[1] = rect->y;
+        command.dst[2] = rect->w;
+        command.dst[3] = rect->h;
+    }
+}
+
+void RenderRecorder::line(SDL_Renderer* renderer, float x1, float y1, float x2, float y2) {
+    RenderCommand& command = push(RENDER_OP_LINE);
+    rendererState(renderer, command);
+    command.dst[0] = x1;
+    command.dst[1] = y1;
+    command.dst[2] = x2;
+    command.dst[3] = y2;
+}
+
+void RenderRecorder::clear(SDL_Renderer* renderer) {
+    RenderCommand& command = push(RENDER_OP_CLEAR);
+    rendererState(renderer, command);
+}
+
+void RenderRecorder::geometry(SDL_Renderer* renderer, SDL_Texture* texture, const SDL_Vertex* verts,
+                              int vertexCount, const int* indexList, int indexCount) {
+    RenderCommand& command = push(RENDER_OP_GEOMETRY);
+    if (texture) {
+        textureState(texture, command);
+    } else {
+        rendererState(renderer, command);
+    }
+    command.vertexCount = static_cast<uint32_t>(vertexCount);
+    command.indexCount = indexList ? static_cast<uint32_t>(indexCount) : 0;
+
+    for (int i = 0; i < vertexCount; i++) {
+        const SDL_Vertex& vert = verts[i];
+        vertices.push_back({vert.position.x, vert.position.y,
+                            {vert.color.r, vert.color.g, vert.color.b, vert.color.a},
+                            vert.tex_coord.x, vert.tex_coord.y});
+    }
+    if (indexList) {
+        indices.insert(indices.end(), indexList, indexList + indexCount);
+    }
+}
+
+void RenderRecorder::setTarget(SDL_Texture* target) {
+    RenderCommand& command = push(RENDER_OP_SET_TARGET);
+    command.texture = textureId(target);
+}
+
+void RenderRecorder::readPixels(const SDL_Rect* rect) {
+    RenderCommand& command = push(RENDER_OP_READ_PIXELS);
+    if (rect) {
+        command.dst[0] = static_cast<float>(rect->x);
+        command.dst[1] = static_cast<float>(rect->y);
+        command.dst[2] = static_cast<float>(rect->w);
+        command.dst[3] = static_cast<float>(rect->h);
+    }
+}
+
+void RenderRecorder::setScale(float scaleX, float scaleY) {
+    RenderCommand& command = push(RENDER_OP_SET_SCALE);
+    command.dst[0] = scaleX;
+    command.dst[1] = scaleY;
+}
+
+bool RenderRecorder::write() {
+    FILE* file = fopen(path.c_str(), "wb");
+    if (!file) return false;
+
+    RenderStreamHeader header;
+    std::memcpy(header.magic, RENDER_STREAM_MAGIC, sizeof(RENDER_STREAM_MAGIC));
+    header.version = RENDER_STREAM_VERSION;
+    header.width = width;
+    header.height = height;
+    header.frameCount = static_cast<uint32_t>(frames.size());
+    header.textureCount = static_cast<uint32_t>(textures.size());
+
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1;
+    if (ok && !textures.empty()) {
+        ok = fwrite(textures.data(), sizeof(RenderStreamTexture), textures.size(), file) == textures.size();
+    }
+
+    size_t command = 0, vertex = 0, index = 0;
+    size_t drawCalls = 0;
+    for (const RenderStreamFrame& frame : frames) {
+        if (!ok) break;
+        ok = fwrite(&frame, sizeof(frame), 1, file) == 1 &&
+             fwrite(commands.data() + command, sizeof(RenderCommand), frame.commandCount, file) == frame.commandCount &&
+             fwrite(vertices.data() + vertex, sizeof(RenderStreamVertex), frame.vertexCount, file) == frame.vertexCount &&
+             fwrite(indices.data() + index, sizeof(int32_t), frame.indexCount, file) == frame.indexCount;
+        for (uint32_t i = 0; i < frame.commandCount; i++) {
+            uint8_t op = commands[command + i].op;
+            if (op == RENDER_OP_COPY || op == RENDER_OP_FILL_RECT || op == RENDER_OP_LINE || op == RENDER_OP_GEOMETRY) {
+                drawCalls++;
+            }
+        }
+        command += frame.commandCount;
+        vertex += frame.vertexCount;
+        index += frame.indexCount;
+    }
+    ok = (fclose(file) == 0) && ok;
+
+    if (ok) {
+        LOG_INFO("Wrote %zu frames of render commands to %s (%.1f draw calls a frame, %zu textures)",
+                 frames.size(), path.c_str(), frames.empty() ? 0.0 : static_cast<double>(drawCalls) / frames.size(),
+                 textures.size());
+    }
+    return ok;
+}
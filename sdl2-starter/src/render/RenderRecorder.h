@@ -0,0 +1,157 @@
+#ifndef RENDER_RECORDER_H
+#define RENDER_RECORDER_H
+
+#include "RenderStreamFormat.h"
+#include <SDL2/SDL.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Captures every draw call of the next N frames into a command stream
+// (RenderStreamFormat.h) that tools/renderreplay.cpp plays back against SDL's
+// software and accelerated renderers, so render cost can be measured apart
+// from the simulation. Each command carries the color, blend mode and texture
+// mods it was drawn with, so the stream replays without tracking state.
+//
+// Render code draws through Draw (below) instead of calling SDL directly; that
+// costs one branch per call while nothing is recording. Main thread only.
+class RenderRecorder {
+private:
+    std::vector<RenderCommand> commands;      // every frame's, back to back
+    std::vector<RenderStreamVertex> vertices;
+    std::vector<int32_t> indices;
+    std::vector<RenderStreamFrame> frames;
+    std::vector<RenderStreamTexture> textures;
+    std::unordered_map<SDL_Texture*, int> textureIds;
+
+    int framesLeft;
+    int width, height;
+    std::string path;
+    size_t frameCommands, frameVertices, frameIndices;  // sizes when the frame began
+    Uint64 frameStart;
+
+    static bool recording;  // only inside a captured frame
+    static RenderRecorder* instance;
+
+    RenderRecorder();  // Private constructor for singleton
+
+    int textureId(SDL_Texture* texture);
+    RenderCommand& push(RenderOp op);
+    void rendererState(SDL_Renderer* renderer, RenderCommand& command);
+    void textureState(SDL_Texture* texture, RenderCommand& command);
+    bool write();
+
+public:
+    static RenderRecorder* getInstance();
+
+    static bool isRecording() { return recording; }
+
+    // Record the next frames frames into outputPath. Ignored while a capture runs.
+    void start(int frames, const std::string& outputPath);
+
+    // Around everything drawn for one frame; endFrame writes the file after the last
+    void beginFrame(SDL_Renderer* renderer);
+    void endFrame();
+
+    void copy(SDL_Renderer* renderer, SDL_Texture* texture, const SDL_Rect* src, const SDL_FRect* dst,
+              double angle, const SDL_FPoint* center, SDL_RendererFlip flip);
+    void fillRect(SDL_Renderer* renderer, const SDL_FRect* rect);
+    void line(SDL_Renderer* renderer, float x1, float y1, float x2, float y2);
+    void clear(SDL_Renderer* renderer);
+    void geometry(SDL_Renderer* renderer, SDL_Texture* texture, const SDL_Vertex* verts, int vertexCount,
+                  const int* indexList, int indexCount);
+    void setTarget(SDL_Texture* target);
+    void readPixels(const SDL_Rect* rect);
+    void setScale(float scaleX, float scaleY);
+};
+
+// SDL's draw calls, recorded while the RenderRecorder captures
+struct Draw {
+    static const SDL_FRect* toFloat(const SDL_Rect* rect, SDL_FRect& out) {
+        if (!rect) return nullptr;
+        out = {static_cast<float>(rect->x), static_cast<float>(rect->y),
+               static_cast<float>(rect->w), static_cast<float>(rect->h)};
+        return &out;
+    }
+
+    static int copy(SDL_Renderer* renderer, SDL_Texture* texture, const SDL_Rect* src, const SDL_Rect* dst) {
+        if (RenderRecorder::isRecording()) {
+            SDL_FRect dstF;
+            RenderRecorder::getInstance()->copy(renderer, texture, src, toFloat(dst, dstF), 0.0, nullptr, SDL_FLIP_NONE);
+        }
+        return SDL_RenderCopy(renderer, texture, src, dst);
+    }
+
+    static int copyF(SDL_Renderer* renderer, SDL_Texture* texture, const SDL_Rect* src, const SDL_FRect* dst) {
+        if (RenderRecorder::isRecording()) {
+            RenderRecorder::getInstance()->copy(renderer, texture, src, dst, 0.0, nullptr, SDL_FLIP_NONE);
+        }
+        return SDL_RenderCopyF(renderer, texture, src, dst);
+    }
+
+    static int copyEx(SDL_Renderer* renderer, SDL_Texture* texture, const SDL_Rect* src, const SDL_Rect* dst,
+                      double angle, const SDL_Point* center, SDL_RendererFlip flip) {
+        if (RenderRecorder::isRecording()) {
+            SDL_FRect dstF;
+            SDL_FPoint centerF;
+            if (center) centerF = {static_cast<float>(center->x), static_cast<float>(center->y)};
+            RenderRecorder::getInstance()->copy(renderer, texture, src, toFloat(dst, dstF), angle,
+                                                center ? &centerF : nullptr, flip);
+        }
+        return SDL_RenderCopyEx(renderer, texture, src, dst, angle, center, flip);
+    }
+
+    static int fillRect(SDL_Renderer* renderer, const SDL_Rect* rect) {
+        if (RenderRecorder::isRecording()) {
+            SDL_FRect rectF;
+            RenderRecorder::getInstance()->fillRect(renderer, toFloat(rect, rectF));
+        }
+        return SDL_RenderFillRect(renderer, rect);
+    }
+
+    static int line(SDL_Renderer* renderer, int x1, int y1, int x2, int y2) {
+        if (RenderRecorder::isRecording()) {
+            RenderRecorder::getInstance()->line(renderer, static_cast<float>(x1), static_cast<float>(y1),
+                                                static_cast<float>(x2), static_cast<float>(y2));
+        }
+        return SDL_RenderDrawLine(renderer, x1, y1, x2, y2);
+    }
+
+    static int clear(SDL_Renderer* renderer) {
+        if (RenderRecorder::isRecording()) {
+            RenderRecorder::getInstance()->clear(renderer);
+        }
+        return SDL_RenderClear(renderer);
+    }
+
+    static int geometry(SDL_Renderer* renderer, SDL_Texture* texture, const SDL_Vertex* verts, int vertexCount,
+                        const int* indexList, int indexCount) {
+        if (RenderRecorder::isRecording()) {
+            RenderRecorder::getInstance()->geometry(renderer, texture, verts, vertexCount, indexList, indexCount);
+        }
+        return SDL_RenderGeometry(renderer, texture, verts, vertexCount, indexList, indexCount);
+    }
+
+    static int setTarget(SDL_Renderer* renderer, SDL_Texture* target) {
+        if (RenderRecorder::isRecording()) {
+            RenderRecorder::getInstance()->setTarget(target);
+        }
+        return SDL_SetRenderTarget(renderer, target);
+    }
+
+    static int readPixels(SDL_Renderer* renderer, const SDL_Rect* rect, Uint32 format, void* pixels, int pitch) {
+        if (RenderRecorder::isRecording()) {
+            RenderRecorder::getInstance()->readPixels(rect);
+        }
+        return SDL_RenderReadPixels(renderer, rect, format, pixels, pitch);
+    }
+
+    static int setScale(SDL_Renderer* renderer, float scaleX, float scaleY) {
+        if (RenderRecorder::isRecording()) {
+            RenderRecorder::getInstance()->setScale(scaleX, scaleY);
+        }
+        return SDL_RenderSetScale(renderer, scaleX, scaleY);
+    }
+};
+
+#endif // RENDER_RECORDER_H
@@ -0,0 +1,88 @@
+#ifndef RENDER_STREAM_FORMAT_H
+#define RENDER_STREAM_FORMAT_H
+
+#include <cstdint>
+
+// On-disk layout of a recorded render-command stream, shared by the game
+// (RenderRecorder) and the replayer (tools/renderreplay.cpp). Little-endian:
+//
+//   RenderStreamHeader
+//   RenderStreamTexture[textureCount]     indexed by RenderCommand::texture
+//   frameCount times:
+//     RenderStreamFrame
+//     RenderCommand[commandCount]
+//     RenderStreamVertex[vertexCount]     every GEOMETRY command's, in order
+//     int32_t[indexCount]                 likewise
+//
+// Only the shape of each texture is kept, not its pixels: replays draw
+// same-sized stand-ins, which costs the renderer the same.
+
+static const char RENDER_STREAM_MAGIC[4] = {'F', 'G', 'R', 'S'};
+static const uint32_t RENDER_STREAM_VERSION = 2;  // 2 added SET_SCALE; version 1 streams still read
+
+enum RenderOp : uint8_t {
+    RENDER_OP_CLEAR = 0,        // color
+    RENDER_OP_COPY,             // texture, src, dst, angle, center, flip, color (mods), blend
+    RENDER_OP_FILL_RECT,        // dst, color, blend
+    RENDER_OP_LINE,             // dst holds x1, y1, x2, y2; color, blend
+    RENDER_OP_GEOMETRY,         // texture, vertexCount, indexCount, blend
+    RENDER_OP_SET_TARGET,       // texture, -1 for the window
+    RENDER_OP_READ_PIXELS,      // dst, read back as RGBA32
+    RENDER_OP_SET_SCALE,        // dst holds the x and y scale; SDL resets it to 1 on every SET_TARGET
+    RENDER_OP_COUNT
+};
+
+struct RenderStreamHeader {
+    char magic[4];
+    uint32_t version;
+    int32_t width;              // renderer output size
+    int32_t height;
+    uint32_t frameCount;
+    uint32_t textureCount;
+};
+
+struct RenderStreamTexture {
+    int32_t width;
+    int32_t height;
+    uint32_t format;            // SDL_PixelFormatEnum
+    int32_t access;             // SDL_TextureAccess
+};
+
+struct RenderStreamFrame {
+    uint32_t commandCount;
+    uint32_t vertexCount;
+    uint32_t indexCount;
+    float renderMs;             // what the game spent in Render for this frame
+};
+
+// One draw call with the renderer and texture state it was made under. A rect
+// with a negative width stands for SDL's null: the whole texture or target.
+struct RenderCommand {
+    uint8_t op;                 // RenderOp
+    uint8_t flip;               // SDL_RendererFlip
+    uint8_t hasCenter;          // else rotate about the dst center
+    uint8_t reserved;
+    int32_t texture;            // index into the texture table, -1 for none
+    uint32_t blend;             // SDL_BlendMode of the texture, or of the renderer when untextured
+    uint8_t color[4];           // draw color, or the texture's color and alpha mod
+    float src[4];               // x, y, w, h
+    float dst[4];
+    float center[2];
+    float angle;                // degrees, clockwise
+    uint32_t vertexCount;
+    uint32_t indexCount;
+};
+
+struct RenderStreamVertex {
+    float x, y;
+    uint8_t color[4];
+    float u, v;
+};
+
+static_assert(sizeof(RenderStreamHeader) == 24, "RenderStreamHeader layout changed");
+static_assert(sizeof(RenderStreamTexture) == 16, "RenderStreamTexture layout changed");
+static_assert(sizeof(RenderStreamFrame) == 16, "RenderStreamFrame layout changed");
+static_assert(sizeof(RenderCommand) == 68, "RenderCommand layout changed");
+static_assert(sizeof(RenderStreamVertex) == 20, "RenderStreamVertex layout changed");
+
+#endif // RENDER_STREAM_FORMAT_H
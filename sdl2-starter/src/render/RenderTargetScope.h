@@ -0,0 +1,41 @@
+#ifndef RENDER_TARGET_SCOPE_H
+#define RENDER_TARGET_SCOPE_H
+
+#include "RenderRecorder.h"
+#include <SDL2/SDL.h>
+
+// Draws into a texture while in scope, then puts back the target that was set
+// before instead of the window: the scene may itself be going to a texture
+// (render/LowResTarget.h). SDL resets the scale to 1 whenever the target
+// changes, which is what drawing into the texture wants, so the old scale is
+// put back too.
+class RenderTargetScope {
+private:
+    SDL_Renderer* renderer;
+    SDL_Texture* previous;
+    float scaleX, scaleY;
+    bool active;
+
+public:
+    RenderTargetScope(SDL_Renderer* renderer, SDL_Texture* target)
+        : renderer(renderer), previous(SDL_GetRenderTarget(renderer)), scaleX(1.0f), scaleY(1.0f) {
+        SDL_RenderGetScale(renderer, &scaleX, &scaleY);
+        active = target && Draw::setTarget(renderer, target) == 0;
+    }
+
+    ~RenderTargetScope() {
+        if (!active) return;
+        Draw::setTarget(renderer, previous);
+        if (scaleX != 1.0f || scaleY != 1.0f) {
+            Draw::setScale(renderer, scaleX, scaleY);
+        }
+    }
+
+    RenderTargetScope(const RenderTargetScope&) = delete;
+    RenderTargetScope& operator=(const RenderTargetScope&) = delete;
+
+    // False if the target couldn't be set; drawing would go to the old one
+    bool isActive() const { return active; }
+};
+
+#endif // RENDER_TARGET_SCOPE_H
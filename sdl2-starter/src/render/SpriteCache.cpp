@@ -0,0 +1,202 @@
+#include "SpriteCache.h"
+#include "RenderRecorder.h"
+#include "RenderTargetScope.h"
+#include "../Logger.h"
+#include <cmath>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// A variant's cell keeps the tint and blending the sprite is drawn with
+static void matchTextureState(SDL_Texture* from, SDL_Texture* to) {
+    Uint8 r = 255, g = 255, b = 255, a = 255;
+    SDL_BlendMode blend = SDL_BLENDMODE_BLEND;
+    SDL_GetTextureColorMod(from, &r, &g, &b);
+    SDL_GetTextureAlphaMod(from, &a);
+    SDL_GetTextureBlendMode(from, &blend);
+    SDL_SetTextureColorMod(to, r, g, b);
+    SDL_SetTextureAlphaMod(to, a);
+    SDL_SetTextureBlendMode(to, blend);
+}
+
+SpriteCache::SpriteCache(int angleSteps) : angles(angleSteps < 1 ? 1 : angleSteps) {}
+
+SpriteCache::~SpriteCache() {
+    clear();
+}
+
+bool SpriteCache::wanted(SDL_Renderer* renderer, int option) {
+    if (option >= 0) return option > 0;
+    SDL_RendererInfo info;
+    return renderer && SDL_GetRendererInfo(renderer, &info) == 0 && (info.flags & SDL_RENDERER_SOFTWARE);
+}
+
+void SpriteCache::clear() {
+    for (Sprite& sprite : sprites) {
+        if (sprite.atlas) {
+            SDL_DestroyTexture(sprite.atlas);
+        }
+    }
+    sprites.clear();
+}
+
+int SpriteCache::find(SDL_Texture* texture, const SDL_Rect* src) const {
+    for (size_t i = 0; i < sprites.size(); i++) {
+        const Sprite& sprite = sprites[i];
+        if (sprite.texture != texture || sprite.wholeTexture != (src == nullptr)) continue;
+        if (src && (sprite.src.x != src->x || sprite.src.y != src->y || sprite.src.w != src->w || sprite.src.h != src->h)) {
+            continue;
+        }
+        return static_cast<int>(i);
+    }
+    return -1;
+}
+
+int SpriteCache::bake(SDL_Renderer* renderer, SDL_Texture* texture, const SDL_Rect* src, int width, int height) {
+    Sprite sprite;
+    sprite.texture = texture;
+    sprite.src = src ? *src : SDL_Rect{0, 0, 0, 0};
+    sprite.wholeTexture = (src == nullptr);
+    sprite.width = width;
+    sprite.height = height;
+    sprite.atlas = nullptr;
+
+    // Rotated cells have room for any angle; flip-only cells are the sprite's size
+    if (angles > 1) {
+        int side = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(width * width + height * height)))) + 2;
+        sprite.cellWidth = sprite.cellHeight = side;
+    } else {
+        sprite.cellWidth = width;
+        sprite.cellHeight = height;
+    }
+    int variants = angles * 2;
+    sprite.columns = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(variants))));
+    int rows = (variants + sprite.columns - 1) / sprite.columns;
+    sprite.atlasWidth = sprite.columns * sprite.cellWidth;
+    sprite.atlasHeight = rows * sprite.cellHeight;
+
+    SDL_Texture* atlas = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+                                           sprite.atlasWidth, sprite.atlasHeight);
+    if (atlas) {
+        Uint8 drawR, drawG, drawB, drawA;
+        SDL_GetRenderDrawColor(renderer, &drawR, &drawG, &drawB, &drawA);
+
+        RenderTargetScope target(renderer, atlas);
+        if (target.isActive()) {
+            SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+            Draw::clear(renderer);
+
+            // Copy the pixels as they are, alpha included; tint is applied when drawn
+            Uint8 r = 255, g = 255, b = 255, a = 255;
+            SDL_BlendMode blend = SDL_BLENDMODE_BLEND;
+            SDL_GetTextureColorMod(texture, &r, &g, &b);
+            SDL_GetTextureAlphaMod(texture, &a);
+            SDL_GetTextureBlendMode(texture, &blend);
+            SDL_SetTextureColorMod(texture, 255, 255, 255);
+            SDL_SetTextureAlphaMod(texture, 255);
+            SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_NONE);
+
+            double step = 360.0 / angles;
+            for (int variant = 0; variant < variants; variant++) {
+                bool mirrored = variant >= angles;
+                SDL_Rect cell = {(variant % sprite.columns) * sprite.cellWidth + (sprite.cellWidth - width) / 2,
+                                 (variant / sprite.columns) * sprite.cellHeight + (sprite.cellHeight - height) / 2,
+                                 width, height};
+                Draw::copyEx(renderer, texture, src, &cell, (variant % angles) * step, nullptr,
+                             mirrored ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE);
+            }
+
+            SDL_SetTextureColorMod(texture, r, g, b);
+            SDL_SetTextureAlphaMod(texture, a);
+            SDL_SetTextureBlendMode(texture, blend);
+            SDL_SetTextureBlendMode(atlas, SDL_BLENDMODE_BLEND);
+            sprite.atlas = atlas;
+        } else {
+            SDL_DestroyTexture(atlas);
+        }
+
+        SDL_SetRenderDrawColor(renderer, drawR, drawG, drawB, drawA);
+    }
+
+    if (sprite.atlas) {
+        LOG_DEBUG("Cached %d variants of a %dx%d sprite", variants, width, height);
+    } else {
+        // Remembered anyway, so it isn't retried every frame
+        LOG_WARN("Couldn't cache a %dx%d sprite, drawing it directly: %s", width, height, SDL_GetError());
+    }
+    sprites.push_back(sprite);
+    return static_cast<int>(sprites.size()) - 1;
+}
+
+int SpriteCache::getSprite(SDL_Renderer* renderer, SDL_Texture* texture, const SDL_Rect* src, int width, int height) {
+    if (!texture || width <= 0 || height <= 0) return -1;
+    int index = find(texture, src);
+    if (index < 0) {
+        index = bake(renderer, texture, src, width, height);
+    }
+    return sprites[index].atlas ? index : -1;
+}
+
+bool SpriteCache::getCell(int index, double angle, SDL_RendererFlip flip, Cell& out) const {
+    if (index < 0 || index >= static_cast<int>(sprites.size())) return false;
+    const Sprite& sprite = sprites[index];
+    if (!sprite.atlas) return false;
+
+    // A vertical flip is the mirror image turned half way round
+    bool mirrored = (flip & SDL_FLIP_HORIZONTAL) != 0;
+    double orientation = angle;
+    if (flip & SDL_FLIP_VERTICAL) {
+        mirrored = !mirrored;
+        orientation += 180.0;
+    }
+    if (angles == 1 && std::fabs(std::remainder(orientation, 360.0)) > 0.5) {
+        return false;
+    }
+
+    int step = static_cast<int>(std::lround(orientation * angles / 360.0)) % angles;
+    if (step < 0) step += angles;
+    int variant = (mirrored ? angles : 0) + step;
+
+    out.atlas = sprite.atlas;
+    out.rect = {(variant % sprite.columns) * sprite.cellWidth, (variant / sprite.columns) * sprite.cellHeight,
+                sprite.cellWidth, sprite.cellHeight};
+    out.u0 = static_cast<float>(out.rect.x) / sprite.atlasWidth;
+    out.v0 = static_cast<float>(out.rect.y) / sprite.atlasHeight;
+    out.u1 = static_cast<float>(out.rect.x + out.rect.w) / sprite.atlasWidth;
+    out.v1 = static_cast<float>(out.rect.y + out.rect.h) / sprite.atlasHeight;
+    out.scaleX = static_cast<float>(sprite.cellWidth) / sprite.width;
+    out.scaleY = static_cast<float>(sprite.cellHeight) / sprite.height;
+    return true;
+}
+
+int SpriteCache::copyEx(SDL_Renderer* renderer, SDL_Texture* texture, const SDL_Rect* src, const SDL_Rect* dst,
+                        double angle, const SDL_Point* center, SDL_RendererFlip flip) {
+    Cell cell;
+    int index = dst ? getSprite(renderer, texture, src, dst->w, dst->h) : -1;
+    if (index < 0 || !getCell(index, angle, flip, cell)) {
+        return Draw::copyEx(renderer, texture, src, dst, angle, center, flip);
+    }
+
+    // Where SDL would put the sprite's center: dst's center, turned about the pivot
+    float cx = dst->x + dst->w * 0.5f;
+    float cy = dst->y + dst->h * 0.5f;
+    if (center && angle != 0.0) {
+        float px = static_cast<float>(dst->x + center->x);
+        float py = static_cast<float>(dst->y + center->y);
+        float radians = static_cast<float>(angle * M_PI / 180.0);
+        float c = std::cos(radians);
+        float s = std::sin(radians);
+        float dx = cx - px;
+        float dy = cy - py;
+        cx = px + dx * c - dy * s;
+        cy = py + dx * s + dy * c;
+    }
+
+    float w = dst->w * cell.scaleX;
+    float h = dst->h * cell.scaleY;
+    SDL_Rect out = {static_cast<int>(std::lround(cx - w * 0.5f)), static_cast<int>(std::lround(cy - h * 0.5f)),
+                    static_cast<int>(std::lround(w)), static_cast<int>(std::lround(h))};
+    matchTextureState(texture, cell.atlas);
+    return Draw::copy(renderer, cell.atlas, &cell.rect, &out);
+}
@@ -0,0 +1,72 @@
+#ifndef SPRITE_CACHE_H
+#define SPRITE_CACHE_H
+
+#include <SDL2/SDL.h>
+#include <vector>
+
+// Pre-rendered rotations and flips of sprites, for the software renderer: there
+// SDL_RenderCopyEx with an angle or a flip goes through a temporary rotated
+// surface, while a straight copy is a blit. Each sprite is baked on first use
+// into its own atlas (a render target) at the size it's first drawn: `angles`
+// evenly spaced rotations, each unflipped and mirrored. A vertical flip is a
+// mirror turned 180 degrees, so that's covered too. Draws then pick the
+// nearest baked angle and copy it straight, scaled if the size has changed.
+//
+// With angles = 1 only flips are baked; rotated draws fall back to RenderCopyEx.
+// Sprites are keyed by texture and source rect, so the textures must outlive
+// the cache. Main thread only, like everything that touches the renderer.
+class SpriteCache {
+public:
+    // Where one variant is in its atlas
+    struct Cell {
+        SDL_Texture* atlas;
+        SDL_Rect rect;
+        float u0, v0, u1, v1;  // rect as texture coordinates, for QuadBatch
+        float scaleX, scaleY;  // cell size over the sprite size it was baked at
+    };
+
+private:
+    struct Sprite {
+        SDL_Texture* texture;
+        SDL_Rect src;
+        bool wholeTexture;
+        int width, height;      // baked size
+        int cellWidth, cellHeight;
+        int columns;
+        int atlasWidth, atlasHeight;
+        SDL_Texture* atlas;     // null if baking failed; then it's always drawn directly
+    };
+
+    int angles;
+    std::vector<Sprite> sprites;
+
+    int find(SDL_Texture* texture, const SDL_Rect* src) const;
+    int bake(SDL_Renderer* renderer, SDL_Texture* texture, const SDL_Rect* src, int width, int height);
+
+public:
+    explicit SpriteCache(int angleSteps);
+    ~SpriteCache();
+
+    SpriteCache(const SpriteCache&) = delete;
+    SpriteCache& operator=(const SpriteCache&) = delete;
+
+    // Whether to cache at all: option > 0 always, 0 never, < 0 only on the software renderer
+    static bool wanted(SDL_Renderer* renderer, int option);
+
+    // The sprite for src of texture (the whole texture when null), baked at
+    // width x height the first time it's asked for; -1 if it can't be cached
+    int getSprite(SDL_Renderer* renderer, SDL_Texture* texture, const SDL_Rect* src, int width, int height);
+
+    // The baked variant nearest to drawing the sprite rotated by angle degrees
+    // about its center with flip; false if there is none (flips-only cache)
+    bool getCell(int sprite, double angle, SDL_RendererFlip flip, Cell& out) const;
+
+    // Drop-in for SDL_RenderCopyEx: a straight copy of the nearest variant,
+    // or the real thing when the sprite can't be cached
+    int copyEx(SDL_Renderer* renderer, SDL_Texture* texture, const SDL_Rect* src, const SDL_Rect* dst,
+               double angle, const SDL_Point* center, SDL_RendererFlip flip);
+
+    void clear();
+};
+
+#endif // SPRITE_CACHE_H
@@ -0,0 +1,154 @@
+#include "FlowField.h"
+#include <algorithm>
+
+const int FlowField::GRASS_COST;
+const int FlowField::SWAMP_COST;
+const int FlowField::WATER_COST;
+const uint16_t FlowField::UNREACHED;
+
+FlowField::FlowField(int w, int h, int cs)
+    : width(w), height(h), cellSize(cs), goalX(-1), goalY(-1),
+      terrainVersion(0), built(false), rebuilds(0) {
+    cost.resize(width * height, GRASS_COST);
+    distance.resize(width * height, UNREACHED);
+    stepX.resize(width * height, 0);
+    stepY.resize(width * height, 0);
+
+    // One bucket per possible distance offset; each can hold every cell, so
+    // rebuilding never allocates
+    buckets.resize(WATER_COST + 1);
+    for (auto& bucket : buckets) {
+        bucket.reserve(width * height);
+    }
+}
+
+int FlowField::cellIndex(int pixelX, int pixelY) const {
+    int x = std::min(std::max(pixelX / cellSize, 0), width - 1);
+    int y = std::min(std::max(pixelY / cellSize, 0), height - 1);
+    return x + y * width;
+}
+
+bool FlowField::update(const TerrainGrid& terrain, int goalPixelX, int goalPixelY) {
+    int index = cellIndex(goalPixelX, goalPixelY);
+    int newGoalX = index % width;
+    int newGoalY = index / width;
+
+    bool terrainChanged = !built || terrain.getVersion() != terrainVersion;
+    if (!terrainChanged && newGoalX == goalX && newGoalY == goalY) {
+        return false;  // Same cell, same map: the field is still right
+    }
+
+    if (terrainChanged) {
+        buildCosts(terrain);
+        terrainVersion = terrain.getVersion();
+    }
+    goalX = newGoalX;
+    goalY = newGoalY;
+    buildDistances();
+    buildDirections();
+
+    built = true;
+    rebuilds++;
+    return true;
+}
+
+void FlowField::buildCosts(const TerrainGrid& terrain) {
+    int w = std::min(width, terrain.getWidth());
+    int h = std::min(height, terrain.getHeight());
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            if (terrain.isWater(x, y)) {
+                cost[x + y * width] = WATER_COST;
+            } else if (terrain.isSwamp(x, y)) {
+                cost[x + y * width] = SWAMP_COST;
+            } else {
+                cost[x + y * width] = GRASS_COST;
+            }
+        }
+    }
+}
+
+void FlowField::buildDistances() {
+    std::fill(distance.begin(), distance.end(), UNREACHED);
+    for (auto& bucket : buckets) {
+        bucket.clear();
+    }
+
+    const int ringSize = static_cast<int>(buckets.size());
+    int goal = goalX + goalY * width;
+    distance[goal] = 0;
+    buckets[0].push_back(goal);
+
+    int pending = 1;
+    for (int current = 0; pending > 0; current++) {
+        std::vector<int>& bucket = buckets[current % ringSize];
+
+        // Settling a cell can only push into later buckets, never this one
+        for (size_t b = 0; b < bucket.size(); b++) {
+            int cell = bucket[b];
+            pending--;
+            if (distance[cell] != current) continue;  // Stale entry, a shorter path won
+
+            int x = cell % width;
+            int y = cell / width;
+            const int neighbors[4][2] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+            for (const auto& n : neighbors) {
+                int nx = x + n[0];
+                int ny = y + n[1];
+                if (nx < 0 || ny < 0 || nx >= width || ny >= height) continue;
+
+                int next = nx + ny * width;
+                int candidate = current + cost[next];
+                if (candidate < distance[next]) {
+                    distance[next] = static_cast<uint16_t>(std::min(candidate, UNREACHED - 1));
+                    buckets[candidate % ringSize].push_back(next);
+                    pending++;
+                }
+            }
+        }
+        bucket.clear();
+    }
+}
+
+void FlowField::buildDirections() {
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            int cell = x + y * width;
+            int bestX = 0, bestY = 0;
+            const uint16_t here = distance[cell];
+            uint16_t best = here;
+
+            // Eight-way steps; a diagonal is only taken when both cells it cuts
+            // past are also downhill, so enemies don't clip the corner of a pond
+            for (int oy = -1; oy <= 1; oy++) {
+                for (int ox = -1; ox <= 1; ox++) {
+                    int nx = x + ox;
+                    int ny = y + oy;
+                    if ((ox == 0 && oy == 0) || nx < 0 || ny < 0 || nx >= width || ny >= height) continue;
+                    if (ox != 0 && oy != 0 &&
+                        (distance[nx + y * width] >= here || distance[x + ny * width] >= here)) continue;
+
+                    uint16_t d = distance[nx + ny * width];
+                    if (d < best) {
+                        best = d;
+                        bestX = ox;
+                        bestY = oy;
+                    }
+                }
+            }
+
+            stepX[cell] = static_cast<int8_t>(bestX);
+            stepY[cell] = static_cast<int8_t>(bestY);
+        }
+    }
+}
+
+void FlowField::getDirection(int pixelX, int pixelY, int& dx, int& dy) const {
+    int cell = cellIndex(pixelX, pixelY);
+    dx = stepX[cell];
+    dy = stepY[cell];
+}
+
+int FlowField::getMoveCost(int pixelX, int pixelY) const {
+    return cost[cellIndex(pixelX, pixelY)];
+}
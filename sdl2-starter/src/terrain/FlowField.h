@@ -0,0 +1,52 @@
+#pragma once
+#include "TerrainGrid.h"
+#include <vector>
+#include <cstdint>
+
+// Distance field over the TerrainGrid cells toward one goal cell (the frog), plus
+// the step each cell should take to get closer. Ground enemies share one field:
+// moving is a single lookup per enemy, and the field is only rebuilt when the
+// goal changes cell or the terrain changes, at O(cells) per rebuild.
+class FlowField {
+public:
+    // Cost of stepping into a cell of each terrain type; water is slowest
+    static const int GRASS_COST = 2;
+    static const int SWAMP_COST = 3;
+    static const int WATER_COST = 6;
+    static const uint16_t UNREACHED = UINT16_MAX;
+
+    FlowField(int width, int height, int cellSize);
+
+    // Rebuild if the goal moved to another cell or the terrain changed.
+    // Returns true when the field was recomputed.
+    bool update(const TerrainGrid& terrain, int goalPixelX, int goalPixelY);
+
+    // Step (-1, 0 or 1 on each axis) toward the goal for the cell under a pixel
+    void getDirection(int pixelX, int pixelY, int& dx, int& dy) const;
+    uint16_t getDistance(int cellX, int cellY) const { return distance[cellX + cellY * width]; }
+    int getMoveCost(int pixelX, int pixelY) const;
+
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    int getRebuildCount() const { return rebuilds; }
+
+private:
+    int width, height, cellSize;
+    int goalX, goalY;
+    uint32_t terrainVersion;
+    bool built;
+    int rebuilds;
+
+    std::vector<uint8_t> cost;
+    std::vector<uint16_t> distance;
+    std::vector<int8_t> stepX, stepY;
+
+    // Dial's algorithm: costs are small integers, so the open list is a ring of
+    // buckets indexed by distance instead of a heap
+    std::vector<std::vector<int>> buckets;
+
+    int cellIndex(int pixelX, int pixelY) const;
+    void buildCosts(const TerrainGrid& terrain);
+    void buildDistances();
+    void buildDirections();
+};
@@ -2,51 +2,56 @@
 #include "../gameplay.h"
 #include "../GameStateManager.h"
 
+void MenuState::prefetchGameplay() {
+    gameplay::prefetchTextures();
+}
+
 void MenuState::HandleEvents(SDL_Event& event) {
     if (event.type == SDL_KEYDOWN) {
-        std::cout << "Key pressed: " << SDL_GetKeyName(event.key.keysym.sym) << std::endl;
+        LOG_DEBUG("Key pressed: %s", SDL_GetKeyName(event.key.keysym.sym));
         
         // Ensure terrain is initialized before handling any terrain-related keys
         if (!initialized || !terrain) {
-            std::cout << "Terrain not initialized, initializing now..." << std::endl;
+            LOG_DEBUG("Terrain not initialized, initializing now...");
             return;
         }
 
         switch (event.key.keysym.sym) {
             case SDLK_RETURN:
             case SDLK_SPACE: {
-                std::cout << "Starting game..." << std::endl;
+                LOG_INFO("Starting game...");
                 gameplay* gameplayState = new gameplay(stateManager);
                 gameplayState->setTerrain(terrain);
                 gameplayState->setTerrainElements(terrainElems);
+                gameplayState->setOptions(options);
                 stateManager.PushState(gameplayState);  // Use PushState instead of ChangeState
                 return;
             }
             case SDLK_w:
-                std::cout << "Adjusting water threshold up" << std::endl;
+                LOG_DEBUG("Adjusting water threshold up");
                 terrain->setWaterThreshold(terrain->getWaterThreshold() + 0.05f);
                 break;
             case SDLK_s:
-                std::cout << "Adjusting water threshold down" << std::endl;
+                LOG_DEBUG("Adjusting water threshold down");
                 terrain->setWaterThreshold(terrain->getWaterThreshold() - 0.05f);
                 break;
             case SDLK_e:
-                std::cout << "Adjusting grass threshold up" << std::endl;
+                LOG_DEBUG("Adjusting grass threshold up");
                 terrain->setGrassThreshold(terrain->getGrassThreshold() + 0.05f);
                 break;
             case SDLK_d:
-                std::cout << "Adjusting grass threshold down" << std::endl;
+                LOG_DEBUG("Adjusting grass threshold down");
                 terrain->setGrassThreshold(terrain->getGrassThreshold() - 0.05f);
                 break;
             case SDLK_r:
-                std::cout << "Regenerating terrain..." << std::endl;
+                LOG_DEBUG("Regenerating terrain...");
                 terrain->generate();
                 if (terrainElems) {
                     terrainElems->generate();
                 }
                 break;
             default:
-                std::cout << "Unhandled key press" << std::endl;
+                LOG_DEBUG("Unhandled key press");
                 break;
         }
     }
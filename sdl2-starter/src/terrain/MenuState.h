@@ -4,10 +4,14 @@
 #include "../terrainElem.h"
 #include "../RainSystem.h"
 #include "../waterPhysics.h"
+#include "../GameOptions.h"
+#include "../AssetPack.h"
+#include "../Logger.h"
+#include "../render/RenderRecorder.h"
+#include "../render/BackgroundLayer.h"
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_ttf.h>
 #include <memory>
-#include <iostream>
 
 // Forward declarations
 class GameStateManager;
@@ -18,8 +22,10 @@ private:
     std::shared_ptr<terrainElements> terrainElems;
     std::unique_ptr<RainSystem> rainSystem;
     std::unique_ptr<WaterPhysics> waterPhysics;  // Added water physics
+    std::unique_ptr<BackgroundLayer> background;  // Rebaked when W/S, E/D or R change the map
     bool initialized;
     GameStateManager& stateManager;
+    GameOptions options;  // Handed on to each new match
     TTF_Font* pixelFont;
     TTF_Font* pixelFontOutline;
     TTF_Font* titleFont;
@@ -30,21 +36,21 @@ private:
     void renderTextPair(SDL_Renderer* renderer, const char* text, int x, int y, 
                         TTF_Font* regularFont, TTF_Font* outlineFont) {
         if (!outlineFont || !regularFont) {
-            std::cout << "Fonts not loaded!" << std::endl;
+            LOG_ERROR("Fonts not loaded!");
             return;
         }
 
         // First render outline text to get dimensions
         SDL_Surface* outlineSurface = TTF_RenderText_Blended(outlineFont, text, brownColor);
         if (!outlineSurface) {
-            std::cout << "Failed to render outline text surface: " << TTF_GetError() << std::endl;
+            LOG_ERROR("Failed to render outline text surface: %s", TTF_GetError());
             return;
         }
 
         // Create texture for outline text
         SDL_Texture* outlineTexture = SDL_CreateTextureFromSurface(renderer, outlineSurface);
         if (!outlineTexture) {
-            std::cout << "Failed to create outline texture: " << SDL_GetError() << std::endl;
+            LOG_ERROR("Failed to create outline texture: %s", SDL_GetError());
             SDL_FreeSurface(outlineSurface);
             return;
         }
@@ -56,7 +62,7 @@ private:
         // Now render regular text
         SDL_Surface* regularSurface = TTF_RenderText_Blended(regularFont, text, whiteColor);
         if (!regularSurface) {
-            std::cout << "Failed to render regular text surface: " << TTF_GetError() << std::endl;
+            LOG_ERROR("Failed to render regular text surface: %s", TTF_GetError());
             SDL_FreeSurface(outlineSurface);
             SDL_DestroyTexture(outlineTexture);
             return;
@@ -64,7 +70,7 @@ private:
 
         SDL_Texture* regularTexture = SDL_CreateTextureFromSurface(renderer, regularSurface);
         if (!regularTexture) {
-            std::cout << "Failed to create regular texture: " << SDL_GetError() << std::endl;
+            LOG_ERROR("Failed to create regular texture: %s", SDL_GetError());
             SDL_FreeSurface(outlineSurface);
             SDL_FreeSurface(regularSurface);
             SDL_DestroyTexture(outlineTexture);
@@ -75,11 +81,11 @@ private:
         SDL_Rect destRect = {x, y, width, height};
 
         // Render outline text first (brown)
-        SDL_RenderCopy(renderer, outlineTexture, NULL, &destRect);
+        Draw::copy(renderer, outlineTexture, NULL, &destRect);
 
         // Render regular text (white) on top with a slight offset
         SDL_Rect regularRect = {x, y + 1, width - 1, height};
-        SDL_RenderCopy(renderer, regularTexture, NULL, &regularRect);
+        Draw::copy(renderer, regularTexture, NULL, &regularRect);
 
         // Clean up
         SDL_FreeSurface(outlineSurface);
@@ -89,22 +95,29 @@ private:
     }
 
     TTF_Font* loadFont(const char* filename, int size) {
+        // Served from the mapped assets.pack when there is one
+        SDL_RWops* packed = AssetPack::getInstance()->openRW(std::string("fonts/") + filename);
+        if (packed) {
+            TTF_Font* font = TTF_OpenFontRW(packed, 1, size);
+            if (font) return font;
+        }
+
         // Try build directory first
         TTF_Font* font = TTF_OpenFont((std::string("build/debug/fonts/") + filename).c_str(), size);
         if (!font) {
             // Try root fonts directory
             font = TTF_OpenFont((std::string("fonts/") + filename).c_str(), size);
             if (!font) {
-                std::cout << "Failed to load font " << filename << ": " << TTF_GetError() << std::endl;
-                std::cout << "Tried paths: build/debug/fonts/" << filename << " and fonts/" << filename << std::endl;
+                LOG_ERROR("Failed to load font %s: %s", filename, TTF_GetError());
+                LOG_ERROR("Tried paths: build/debug/fonts/%s and fonts/%s", filename, filename);
             }
         }
         return font;
     }
 
 public:
-    MenuState(GameStateManager& manager) 
-        : initialized(false), stateManager(manager), pixelFont(nullptr), pixelFontOutline(nullptr), 
+    MenuState(GameStateManager& manager, const GameOptions& gameOptions = GameOptions()) 
+        : initialized(false), stateManager(manager), options(gameOptions), pixelFont(nullptr), pixelFontOutline(nullptr), 
         titleFont(nullptr), titleFontOutline(nullptr) {
         whiteColor = {255, 255, 255, 255}; // White
         brownColor = {154, 77, 1, 255};    // Brown
@@ -112,9 +125,14 @@ public:
     }
 
     void Init() override {
-        std::cout << "MenuState initialized" << std::endl;
+        LOG_INFO("MenuState initialized");
         initialized = false;
 
+        // Decode the match's textures on worker threads; the main loop uploads
+        // them a few at a time while the menu renders. This screen's own are
+        // needed by the first Render, so they're loaded there.
+        prefetchGameplay();
+
         // Load both fonts with the same size
         pixelFont = loadFont("pixelFont.ttf", 16);
         pixelFontOutline = loadFont("pixelFontOutline.ttf", 16);
@@ -134,25 +152,26 @@ public:
     }
 
     void HandleEvents(SDL_Event& event) override;  // Definition moved to cpp file
+    void prefetchGameplay();  // In the cpp file, which can see gameplay.h
 
     void Render(SDL_Renderer* renderer) override {
         if (!initialized || !terrain) {
-            std::cout << "Creating terrain..." << std::endl;
+            LOG_DEBUG("Creating terrain...");
              // Use 1280, 720, 1 for smoother maps :)
             terrain = std::make_shared<TerrainGrid>(renderer, 64, 36, 20);
             terrain->generate();
             terrainElems = std::make_shared<terrainElements>(renderer, terrain.get(), 1280, 720);
             terrainElems->generate();
             waterPhysics = std::make_unique<WaterPhysics>(renderer);  // Initialize water physics
+            background = std::make_unique<BackgroundLayer>(1280, 720);
             initialized = true;
-            std::cout << "Terrain created" << std::endl;
+            LOG_DEBUG("Terrain created");
         }
 
         SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-        SDL_RenderClear(renderer);
+        Draw::clear(renderer);
         
-        terrain->render(renderer);
-        terrainElems->render();
+        background->render(renderer, terrain.get(), terrainElems.get());
         
         // Render water effects after terrain but before rain
         if (waterPhysics) {
@@ -163,7 +182,9 @@ public:
         if (rainSystem) {
             rainSystem->render(renderer);
         }
-        
+    }
+
+    void RenderHUD(SDL_Renderer* renderer) override {
         // Render text instructions
         renderTextPair(renderer, "FROGGUN", 200, 100, titleFont, titleFontOutline);
         renderTextPair(renderer, "PRESS W/S TO ADJUST WATER LEVEL", 100, 400, pixelFont, pixelFontOutline);
@@ -173,7 +194,7 @@ public:
     }
 
     void CleanUp() override {
-        std::cout << "MenuState cleanup" << std::endl;
+        LOG_INFO("MenuState cleanup");
         if (pixelFont) {
             TTF_CloseFont(pixelFont);
             pixelFont = nullptr;
@@ -1,11 +1,17 @@
 #include "TerrainGrid.h"
 #include <cmath>
 #include <chrono>
-#include <iostream>
+#include "../Logger.h"
+#include "../render/RenderRecorder.h"
+#include "../render/RenderTargetScope.h"
 #include <random>
 
-TerrainGrid::TerrainGrid(SDL_Renderer* r, int w, int h, int cs) 
-    : renderer(r), width(w), height(h), cellSize(cs), waterThreshold(0.425f), grassThreshold(0.55f), needsUpdate(true) {
+TerrainGrid::TerrainGrid(SDL_Renderer* r, int w, int h, int cs)
+    : TerrainGrid(r, w, h, cs, std::random_device{}()) {
+}
+
+TerrainGrid::TerrainGrid(SDL_Renderer* r, int w, int h, int cs, uint32_t mapSeed)
+    : renderer(r), width(w), height(h), cellSize(cs), waterThreshold(0.425f), grassThreshold(0.55f), needsUpdate(true), version(0) {
     
     // Initialize default colors
     waterColor = {8, 143, 143, 255};    // Blue green
@@ -15,20 +21,18 @@ TerrainGrid::TerrainGrid(SDL_Renderer* r, int w, int h, int cs)
     p.resize(512);
     grid.resize(height, std::vector<float>(width));
     
-    // Create texture for caching
-    terrainTexture = SDL_CreateTexture(renderer,
-                                     SDL_PIXELFORMAT_RGBA8888,
-                                     SDL_TEXTUREACCESS_TARGET,
-                                     width * cellSize,
-                                     height * cellSize);
-                                     
-    // Initialize RNG with hardware random device
-    std::random_device rd;
-    seed = rd();
-    rng.seed(seed);
-    
-    // Generate initial terrain
-    generate();
+    // Create texture for caching (headless grids have no renderer and no texture)
+    terrainTexture = nullptr;
+    if (renderer) {
+        terrainTexture = SDL_CreateTexture(renderer,
+                                         SDL_PIXELFORMAT_RGBA8888,
+                                         SDL_TEXTUREACCESS_TARGET,
+                                         width * cellSize,
+                                         height * cellSize);
+    }
+
+    // Generate initial terrain; this seeds the RNG
+    generate(mapSeed);
 }
 
 TerrainGrid::~TerrainGrid() {
@@ -101,21 +105,26 @@ void TerrainGrid::setColors(SDL_Color water, SDL_Color swamp, SDL_Color grass) {
     swampColor = swamp;
     grassColor = grass;
     needsUpdate = true;
+    version++;
 }
 
 void TerrainGrid::generate() {
-    std::cout << "Generating new terrain..." << std::endl;
-
     // Create a new random device for each generation
     std::random_device rd;
     std::mt19937 localRng(rd());
     
     // Generate a completely new seed
     std::uniform_int_distribution<uint32_t> dist(0, std::numeric_limits<uint32_t>::max());
-    seed = dist(localRng);
+    generate(dist(localRng));
+}
+
+void TerrainGrid::generate(uint32_t mapSeed) {
+    LOG_DEBUG("Generating new terrain...");
+
+    seed = mapSeed;
     rng.seed(seed);
     
-    std::cout << "New seed: " << seed << std::endl;
+    LOG_INFO("New terrain seed: %u", static_cast<unsigned>(seed));
 
     // Generate random rotation angle and offsets
     std::uniform_real_distribution<float> angleDist(0.0f, 2.0f * M_PI);
@@ -125,7 +134,7 @@ void TerrainGrid::generate() {
     float offsetX = offsetDist(rng);
     float offsetY = offsetDist(rng);
     
-    std::cout << "Angle: " << angle << ", Offset X: " << offsetX << ", Offset Y: " << offsetY << std::endl;
+    LOG_DEBUG("Angle: %g, Offset X: %g, Offset Y: %g", angle, offsetX, offsetY);
 
     // Generate new permutation table
     initPermutationTable();
@@ -150,59 +159,62 @@ void TerrainGrid::generate() {
             grid[y][x] = value;
         }
     }
+    version++;
 
     // Destroy and recreate texture
     if (terrainTexture) {
         SDL_DestroyTexture(terrainTexture);
+        terrainTexture = nullptr;
+    }
+    if (renderer) {
+        terrainTexture = SDL_CreateTexture(renderer,
+                                         SDL_PIXELFORMAT_RGBA8888,
+                                         SDL_TEXTUREACCESS_TARGET,
+                                         width * cellSize,
+                                         height * cellSize);
     }
-    terrainTexture = SDL_CreateTexture(renderer,
-                                     SDL_PIXELFORMAT_RGBA8888,
-                                     SDL_TEXTUREACCESS_TARGET,
-                                     width * cellSize,
-                                     height * cellSize);
     
     needsUpdate = true;
-    std::cout << "Terrain generation complete." << std::endl;
+    LOG_DEBUG("Terrain generation complete.");
 }
 
 void TerrainGrid::render(SDL_Renderer* renderer) {
     if (needsUpdate) {
-        std::cout << "Updating terrain texture..." << std::endl;
+        LOG_DEBUG("Updating terrain texture...");
         
-        // Set render target to our texture
-        SDL_SetRenderTarget(renderer, terrainTexture);
+        // Set render target to our texture; the scope puts back whatever the scene draws into
+        {
+            RenderTargetScope target(renderer, terrainTexture);
         
-        // Clear the texture first
-        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-        SDL_RenderClear(renderer);
+            // Clear the texture first
+            SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+            Draw::clear(renderer);
         
-        SDL_Rect cell = {0, 0, cellSize, cellSize};
+            SDL_Rect cell = {0, 0, cellSize, cellSize};
 
-        for(int y = 0; y < height; y++) {
-            for(int x = 0; x < width; x++) {
-                cell.x = x * cellSize;
-                cell.y = y * cellSize;
+            for(int y = 0; y < height; y++) {
+                for(int x = 0; x < width; x++) {
+                    cell.x = x * cellSize;
+                    cell.y = y * cellSize;
                 
-                float value = grid[y][x];
+                    float value = grid[y][x];
                 
-                if(value < waterThreshold) {
-                    SDL_SetRenderDrawColor(renderer, waterColor.r, waterColor.g, waterColor.b, waterColor.a);
-                } else if(value < grassThreshold) {
-                    SDL_SetRenderDrawColor(renderer, swampColor.r, swampColor.g, swampColor.b, swampColor.a);
-                } else {
-                    SDL_SetRenderDrawColor(renderer, grassColor.r, grassColor.g, grassColor.b, grassColor.a);
-                }
+                    if(value < waterThreshold) {
+                        SDL_SetRenderDrawColor(renderer, waterColor.r, waterColor.g, waterColor.b, waterColor.a);
+                    } else if(value < grassThreshold) {
+                        SDL_SetRenderDrawColor(renderer, swampColor.r, swampColor.g, swampColor.b, swampColor.a);
+                    } else {
+                        SDL_SetRenderDrawColor(renderer, grassColor.r, grassColor.g, grassColor.b, grassColor.a);
+                    }
                 
-                SDL_RenderFillRect(renderer, &cell);
+                    Draw::fillRect(renderer, &cell);
+                }
             }
         }
-        
-        // Reset render target to default
-        SDL_SetRenderTarget(renderer, nullptr);
         needsUpdate = false;
-        std::cout << "Texture update complete." << std::endl;
+        LOG_DEBUG("Texture update complete.");
     }
     
     // Render the cached texture
-    SDL_RenderCopy(renderer, terrainTexture, nullptr, nullptr);
+    Draw::copy(renderer, terrainTexture, nullptr, nullptr);
 }
@@ -17,6 +17,7 @@ private:
     SDL_Texture* terrainTexture;
     SDL_Renderer* renderer;
     bool needsUpdate;
+    uint32_t version;  // Bumped whenever the drawn map can change: cell types or colors
     uint32_t seed;
     std::mt19937 rng;
 
@@ -31,10 +32,11 @@ private:
 
 public:
     TerrainGrid(SDL_Renderer* renderer, int width, int height, int cellSize);
+    TerrainGrid(SDL_Renderer* renderer, int width, int height, int cellSize, uint32_t mapSeed);
     ~TerrainGrid();
     void setColors(SDL_Color water, SDL_Color swamp, SDL_Color grass);
-    void setWaterThreshold(float threshold) { waterThreshold = threshold; needsUpdate = true; }
-    void setGrassThreshold(float threshold) { grassThreshold = threshold; needsUpdate = true; }
+    void setWaterThreshold(float threshold) { waterThreshold = threshold; needsUpdate = true; version++; }
+    void setGrassThreshold(float threshold) { grassThreshold = threshold; needsUpdate = true; version++; }
     float getWaterThreshold() const { return waterThreshold; }
     float getGrassThreshold() const { return grassThreshold; }
     int getCellSize() const { return cellSize; }
@@ -42,6 +44,9 @@ public:
     int getWidth() const { return width; }
     int getHeight() const { return height; }
     bool isWater(int x, int y) const { return getValueAt(x, y) < waterThreshold; }
-    void generate();
+    bool isSwamp(int x, int y) const { return !isWater(x, y) && getValueAt(x, y) < grassThreshold; }
+    uint32_t getVersion() const { return version; }
+    void generate();                  // New random map
+    void generate(uint32_t mapSeed);  // The same map for the same seed
     void render(SDL_Renderer* renderer);
 };
@@ -1,6 +1,7 @@
 #pragma once
 #include "../GameState.h"
 #include "TerrainGrid.h"
+#include "../render/RenderRecorder.h"
 #include <memory>
 
 class TerrainState : public GameState {
@@ -33,7 +34,7 @@ public:
         }
 
         SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-        SDL_RenderClear(renderer);
+        Draw::clear(renderer);
         
         terrain->render(renderer);
     }
@@ -1,19 +1,27 @@
 #include "terrainElem.h"
+#include "render/RenderRecorder.h"
 #include <random>
 #include <chrono>
 
+static const char* const CATTAIL_PATHS[] = {
+    "assets/terrain/cattail1.png", "assets/terrain/cattail2.png", "assets/terrain/cattail3.png"
+};
+static const char* const STONE_PATHS[] = {
+    "assets/terrain/stone1.png", "assets/terrain/stone2.png", "assets/terrain/stone3.png"
+};
+static const char* const LILYPAD_PATHS[] = {
+    "assets/terrain/lilypad1.png", "assets/terrain/lilypad2.png", "assets/terrain/lilypad3.png"
+};
+
 terrainElements::terrainElements(SDL_Renderer* r, TerrainGrid* g, int width, int height)
-    : renderer(r), grid(g), screenWidth(width), screenHeight(height) {
+    : renderer(r), grid(g), screenWidth(width), screenHeight(height), version(0) {
     // Initialize RNG with time-based seed
     rng.seed(std::chrono::steady_clock::now().time_since_epoch().count());
     loadTextures();
 }
 
 terrainElements::~terrainElements() {
-    // Cleanup textures using SDL_DestroyTexture
-    for (auto tex : cattails) SDL_DestroyTexture(tex);
-    for (auto tex : stones) SDL_DestroyTexture(tex);
-    for (auto tex : lilypads) SDL_DestroyTexture(tex);
+    // Textures are released with their handles; the AssetManager keeps them cached
 }
 
 SDL_Point terrainElements::getTextureSize(SDL_Texture* asset) {
@@ -23,27 +31,22 @@ SDL_Point terrainElements::getTextureSize(SDL_Texture* asset) {
 }
 
 void terrainElements::loadTextures() {
+    // Every instance shares the same nine textures through the AssetManager
+    AssetManager* assets = AssetManager::getInstance();
+
     // Load cattail textures
-    cattails.push_back(IMG_LoadTexture(renderer, "assets/terrain/cattail1.png"));
-    cattails.push_back(IMG_LoadTexture(renderer, "assets/terrain/cattail2.png"));
-    cattails.push_back(IMG_LoadTexture(renderer, "assets/terrain/cattail3.png"));
+    for (const char* path : CATTAIL_PATHS) cattails.push_back(assets->getTexture(renderer, path));
 
     // Load stone textures
-    stones.push_back(IMG_LoadTexture(renderer, "assets/terrain/stone1.png"));
-    stones.push_back(IMG_LoadTexture(renderer, "assets/terrain/stone2.png"));
-    stones.push_back(IMG_LoadTexture(renderer, "assets/terrain/stone3.png"));
-    
-    
+    for (const char* path : STONE_PATHS) stones.push_back(assets->getTexture(renderer, path));
 
     // Load lilypad textures
-    lilypads.push_back(IMG_LoadTexture(renderer, "assets/terrain/lilypad1.png"));
-    lilypads.push_back(IMG_LoadTexture(renderer, "assets/terrain/lilypad2.png"));
-    lilypads.push_back(IMG_LoadTexture(renderer, "assets/terrain/lilypad3.png"));
+    for (const char* path : LILYPAD_PATHS) lilypads.push_back(assets->getTexture(renderer, path));
 }
 
-SDL_Texture* terrainElements::getRandomTexture(const std::vector<SDL_Texture*>& textures) {
+SDL_Texture* terrainElements::getRandomTexture(const std::vector<TextureHandle>& textures) {
     std::uniform_int_distribution<int> dist(0, textures.size() - 1);
-    return textures[dist(rng)];
+    return textures[dist(rng)].get();
 }
 
 void terrainElements::generateSprites(int count) {
@@ -92,10 +95,11 @@ void terrainElements::generateSprites(int count) {
 
 void terrainElements::generate(int spriteCount) {
     generateSprites(spriteCount);
+    version++;
 }
 
 void terrainElements::render() {
     for (const auto& sprite : activeSprites) {
-        SDL_RenderCopyF(renderer, sprite.texture, nullptr, &sprite.rect);
+        Draw::copyF(renderer, sprite.texture, nullptr, &sprite.rect);
     }
 }
@@ -3,6 +3,7 @@
 #include <vector>
 #include <random>
 #include "terrain/TerrainGrid.h"
+#include "AssetManager.h"
 
 // Forward declare SDL_image functions we need
 extern "C" {
@@ -17,19 +18,20 @@ struct TerrainSprite {
 
 class terrainElements {
 private:
-    std::vector<SDL_Texture*> cattails;
-    std::vector<SDL_Texture*> stones;
-    std::vector<SDL_Texture*> lilypads;
+    std::vector<TextureHandle> cattails;
+    std::vector<TextureHandle> stones;
+    std::vector<TextureHandle> lilypads;
     std::vector<TerrainSprite> activeSprites;
     SDL_Renderer* renderer;
     TerrainGrid* grid;
     std::mt19937 rng;
     int screenWidth;
     int screenHeight;
+    uint32_t version;  // Bumped by every generate(), so a cached background knows to redraw
 
     SDL_Point getTextureSize(SDL_Texture *asset);
     void loadTextures();
-    SDL_Texture* getRandomTexture(const std::vector<SDL_Texture*>& textures);
+    SDL_Texture* getRandomTexture(const std::vector<TextureHandle>& textures);
     void generateSprites(int count);
 
 public:
@@ -38,4 +40,5 @@ public:
     
     void generate(int spriteCount = 100);  // Generate specified number of terrain elements
     void render();
+    uint32_t getVersion() const { return version; }
 };
@@ -0,0 +1,81 @@
+#include "EnemyProjectiles.h"
+
+EnemyProjectiles::EnemyProjectiles(int width, int height, int initialCapacity)
+    : batch(2048), worldWidth(width), worldHeight(height) {
+    bullets.reserve(initialCapacity);
+    pendingSpawns.reserve(64);
+}
+
+void EnemyProjectiles::requestSpawn(float x, float y, float velocityX, float velocityY) {
+    pendingSpawns.emplace_back(x, y, velocityX, velocityY);
+}
+
+void EnemyProjectiles::update(float deltaTime) {
+    // Bring in this tick's new bullets
+    bullets.insert(bullets.end(), pendingSpawns.begin(), pendingSpawns.end());
+    pendingSpawns.clear();
+
+    // Move every bullet once and keep only those still on screen, compacting in place
+    size_t kept = 0;
+    for (size_t i = 0; i < bullets.size(); i++) {
+        Bullet& b = bullets[i];
+        b.move(deltaTime);
+
+        bool offScreen = b.rect.y < -b.rect.h || b.rect.y > worldHeight
+                      || b.rect.x < 0 || b.rect.x > worldWidth;
+        if (!offScreen) {
+            if (kept != i) {
+                bullets[kept] = b;
+            }
+            kept++;
+        }
+    }
+    bullets.erase(bullets.begin() + kept, bullets.end());
+}
+
+int EnemyProjectiles::collideWith(const SDL_Rect& target) {
+    const int left = target.x;
+    const int top = target.y;
+    const int right = target.x + target.w;
+    const int bottom = target.y + target.h;
+
+    int hits = 0;
+    size_t kept = 0;
+    for (size_t i = 0; i < bullets.size(); i++) {
+        // Inline AABB overlap test; same result as SDL_HasIntersection for non-empty rects
+        const SDL_Rect& r = bullets[i].rect;
+        if (r.x < right && r.x + r.w > left && r.y < bottom && r.y + r.h > top) {
+            hits++;
+            continue;
+        }
+        if (kept != i) {
+            bullets[kept] = bullets[i];
+        }
+        kept++;
+    }
+    bullets.erase(bullets.begin() + kept, bullets.end());
+    return hits;
+}
+
+void EnemyProjectiles::render(SDL_Renderer* renderer, SDL_Texture* texture) {
+    if (!texture || bullets.empty()) return;
+
+    // Every bullet shares one texture, so draw them all in one batch
+    const SDL_Color white = {255, 255, 255, 255};
+    batch.begin(renderer, texture);
+    for (const Bullet& b : bullets) {
+        batch.addRect(static_cast<float>(b.rect.x), static_cast<float>(b.rect.y),
+                      static_cast<float>(b.rect.w), static_cast<float>(b.rect.h), white);
+    }
+    batch.end();
+}
+
+void EnemyProjectiles::reserve(int capacity) {
+    bullets.reserve(capacity);
+    pendingSpawns.reserve(capacity / 8);
+}
+
+void EnemyProjectiles::clear() {
+    bullets.clear();
+    pendingSpawns.clear();
+}
@@ -0,0 +1,41 @@
+#ifndef ENEMY_PROJECTILES_H
+#define ENEMY_PROJECTILES_H
+
+#include <SDL2/SDL.h>
+#include <vector>
+#include "bulletStruct.h"
+#include "../../render/QuadBatch.h"
+
+// Owns every enemy bullet in the level. Turtles only submit spawn requests; the
+// system applies them, moves each bullet exactly once per tick and culls
+// off-screen bullets in a single compacting pass.
+class EnemyProjectiles {
+private:
+    std::vector<Bullet> bullets;
+    std::vector<Bullet> pendingSpawns;  // requests queued since the last update
+    QuadBatch batch;
+    int worldWidth;
+    int worldHeight;
+
+public:
+    EnemyProjectiles(int width, int height, int initialCapacity = 256);
+
+    // Queue a bullet; it enters the world on the next update
+    void requestSpawn(float x, float y, float velocityX, float velocityY);
+
+    // Apply spawns, integrate and cull
+    void update(float deltaTime);
+
+    // Remove every bullet overlapping target and return how many hit
+    int collideWith(const SDL_Rect& target);
+
+    void render(SDL_Renderer* renderer, SDL_Texture* texture);
+    void reserve(int capacity);
+    void clear();
+
+    const std::vector<Bullet>& getBullets() const { return bullets; }
+    int size() const { return static_cast<int>(bullets.size()); }
+    int capacity() const { return static_cast<int>(bullets.capacity()); }
+};
+
+#endif
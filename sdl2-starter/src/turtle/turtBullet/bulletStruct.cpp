@@ -1,18 +1,13 @@
 #include "bulletStruct.h"
-#include <iostream>
-#include "../../frog/frogClass.h"
 
-Bullet::Bullet(int x, int y, int s, SDL_Texture* tex, float dirX, float dirY)
-    : rect{ x, y, 40, 40 }, speed(s), directionX(dirX), directionY(dirY), texture(tex), active(true) {}
+Bullet::Bullet(float x, float y, float velX, float velY)
+    : x(x), y(y), velocityX(velX), velocityY(velY),
+      rect{ static_cast<int>(x), static_cast<int>(y), 40, 40 } {}
 
-void Bullet::move(float deltaTime, Frog& player) 
+void Bullet::move(float deltaTime) 
 {
-    SDL_Rect frogRect = player.getCollisionBox();
-    rect.x += directionX * speed;
-    rect.y += directionY * speed;
-
-    if (SDL_HasIntersection(&rect, &frogRect)) 
-    {
-        active = false;
-    }
+    x += velocityX * deltaTime;
+    y += velocityY * deltaTime;
+    rect.x = static_cast<int>(x);
+    rect.y = static_cast<int>(y);
 }
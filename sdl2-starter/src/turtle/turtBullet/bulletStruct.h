@@ -2,20 +2,18 @@
 #define BULLET_H
 
 #include <SDL2/SDL.h>
-#include <string>
-#include "../../frog/frogClass.h"
 
+// One enemy projectile. Position is kept in floats so slow bullets don't lose
+// sub-pixel movement; rect is the integer box used for collision and drawing.
 struct Bullet 
 {
+    float x, y;
+    float velocityX;    // pixels per second
+    float velocityY;
     SDL_Rect rect;
-    SDL_Texture* texture;
-    float speed = 1;
-    float directionX;
-    float directionY;
-    bool active;
 
-    Bullet(int x, int y, int s, SDL_Texture* tex, float dirX, float dirY);
-    void move(float deltaTime, Frog& player);
+    Bullet(float x, float y, float velX, float velY);
+    void move(float deltaTime);
 };
 
 #endif
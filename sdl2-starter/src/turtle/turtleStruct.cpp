@@ -1,25 +1,49 @@
 #include "turtleStruct.h"
-#include "turtBullet/bulletStruct.h"
 #include <vector>
-#include <algorithm>  // for remove_if
 #include <ctime>
 #include <cstdlib>
-#include <iostream>
+#include "../Logger.h"
 
 const float TURTLE_SPEED = 0.5f;
 const int TURTLE_MOVE_INTERVAL = 120;
 const int TURTLE_HIDE_DISTANCE = 100;
-const float BULLET_SPEED = 2.0f;
-int Turtle::turtCounter = 0;
+const float BULLET_SPEED = 240.0f;  // pixels per second: 4 a frame at 60 FPS, the old speed with one turtle
+const float SPIRAL_STEP = 0.2f;     // radians the spiral turns per volley
 
 using namespace std;
 
+Turtle::Turtle()
+    : Turtle({0, 0, 0, 0}, false, 0, 0, nullptr) {}
+
 Turtle::Turtle(SDL_Rect r, bool hiding, float dx, float dy, SDL_Texture* tex)
     : rect(r), texture(tex), hiding(hiding), dx(dx), dy(dy), up(0), down(0), left(0), right(0), 
-      bulletTimer(0), facingRight(false), turtmoveTimer(500), moveDuration(0), health(nullptr),
-      pendingRemoval(false) {}
+      bulletTimer(0), facingRight(false), turtmoveTimer(500), moveDuration(0),
+      health(nullptr, MAX_HEALTH), pendingRemoval(false), hurtTimer(0.0f),
+      firePattern(FirePattern::AIMED), fireInterval(300), patternBullets(1), patternAngle(0.0f) {}
 
-void Turtle::updateMovement() 
+void Turtle::reset(SDL_Rect r, SDL_Texture* tex)
+{
+    rect = r;
+    texture = tex;
+    hiding = false;
+    dx = 0.0f;
+    dy = 0.0f;
+    up = down = left = right = 0;
+    bulletTimer = 0;
+    facingRight = false;
+    turtmoveTimer = 500;
+    moveDuration = 0;
+    health = healthBar(nullptr, MAX_HEALTH);
+    pendingRemoval = false;
+    hurtTimer = 0.0f;
+    firePattern = FirePattern::AIMED;
+    fireInterval = 300;
+    patternBullets = 1;
+    patternAngle = 0.0f;
+    ai = AIState();
+}
+
+void Turtle::updateMovement(const FlowField* flowField, std::mt19937& rng) 
 {
     if (pendingRemoval) return;  // Don't move if pending removal
 
@@ -27,26 +51,30 @@ void Turtle::updateMovement()
     {
         if (turtmoveTimer == 0)
         {
-            // rand movement at rand times
-            dx = (rand() % 3 - 1);
-            dy = (rand() % 3 - 1);
-
-            while (dx == 0 && dy == 0)
+            if (!flowField)
             {
-                dx = (rand() % 3 - 1); //no more lazy turtles
-                dy = (rand() % 3 - 1);
-            }
-
-            std::cout << "dx: " << dx << ", dy: " << dy << std::endl;
-            if (dx == 0 || dx == 1)
-            {
-                dx = 1;
-                facingRight = true;
-            }
-
-            if (dx == -1)
-            {
-                facingRight = false;
+                // rand movement at rand times
+                std::uniform_int_distribution<int> step(-1, 1);
+                dx = step(rng);
+                dy = step(rng);
+
+                while (dx == 0 && dy == 0)
+                {
+                    dx = step(rng); //no more lazy turtles
+                    dy = step(rng);
+                }
+
+                LOG_DEBUG("dx: %g, dy: %g", dx, dy);
+                if (dx == 0 || dx == 1)
+                {
+                    dx = 1;
+                    facingRight = true;
+                }
+
+                if (dx == -1)
+                {
+                    facingRight = false;
+                }
             }
 
             turtmoveTimer = 500;
@@ -54,8 +82,27 @@ void Turtle::updateMovement()
         }
         if (moveDuration > 0)
         {
-            rect.x += dx;
-            rect.y += dy;
+            int centerX = rect.x + rect.w / 2;
+            int centerY = rect.y + rect.h / 2;
+            bool step = true;
+
+            if (flowField)
+            {
+                // Follow the shared field toward the frog, wading at half speed
+                int stepX, stepY;
+                flowField->getDirection(centerX, centerY, stepX, stepY);
+                dx = stepX;
+                dy = stepY;
+                if (dx > 0) facingRight = true;
+                if (dx < 0) facingRight = false;
+                step = flowField->getMoveCost(centerX, centerY) < FlowField::WATER_COST || moveDuration % 2 == 0;
+            }
+
+            if (step)
+            {
+                rect.x += dx;
+                rect.y += dy;
+            }
 
             moveDuration--;  
         }
@@ -85,12 +132,24 @@ void Turtle::updateMovement()
     }
 }
 
-void Turtle::fireBullet(vector<Bullet>& bullets, Frog& player, float deltaTime, SDL_Renderer* renderer, SDL_Texture* bulletTexture)
+void Turtle::fireBullet(EnemyProjectiles& projectiles, Frog& player)
 {
     if (hiding || pendingRemoval) return;  // Don't fire if hiding or pending removal
 
     // dang turtles with guns
-    if (bulletTimer >= 300)
+    if (bulletTimer >= fireInterval && firePattern != FirePattern::AIMED)
+    {
+        if (firePattern == FirePattern::RADIAL)
+        {
+            fireRadial(projectiles);
+        }
+        else
+        {
+            fireSpiral(projectiles);
+        }
+        bulletTimer = 0;
+    }
+    else if (bulletTimer >= fireInterval)
     {
         SDL_Rect frogRect = player.getCollisionBox();
         int deltaX = frogRect.x + frogRect.w / 2 - (rect.x + rect.w / 2);
@@ -105,9 +164,9 @@ void Turtle::fireBullet(vector<Bullet>& bullets, Frog& player, float deltaTime,
             int bulletStartX = rect.x + rect.w / 2;
             int bulletStartY = rect.y + rect.h / 2;
 
-            bullets.reserve(bullets.size() + 1);
-            bullets.emplace_back(bulletStartX, bulletStartY, BULLET_SPEED, bulletTexture, directionX, directionY);
-            std::cout << "Magnitude: " << magnitude << " DirectionX: " << directionX << " DirectionY: " << directionY << std::endl;
+            // The projectile system moves and culls it from here on
+            projectiles.requestSpawn(bulletStartX, bulletStartY, directionX, directionY);
+            LOG_DEBUG("Magnitude: %g DirectionX: %g DirectionY: %g", magnitude, directionX, directionY);
         }
 
         // Reset the bullet timer
@@ -117,18 +176,32 @@ void Turtle::fireBullet(vector<Bullet>& bullets, Frog& player, float deltaTime,
     {
         bulletTimer++;
     }
+}
+
+void Turtle::fireVolley(EnemyProjectiles& projectiles, float baseAngle, float angleStep)
+{
+    float centerX = rect.x + rect.w / 2.0f;
+    float centerY = rect.y + rect.h / 2.0f;
 
-    for (auto& bullet : bullets)
+    for (int i = 0; i < patternBullets; i++)
     {
-        bullet.move(deltaTime, player);
+        float angle = baseAngle + angleStep * i;
+        projectiles.requestSpawn(centerX, centerY, BULLET_SPEED * cos(angle), BULLET_SPEED * sin(angle));
     }
+}
 
-    bullets.erase(
-        remove_if(bullets.begin(), bullets.end(), [](Bullet& b)
-            {
-                return b.rect.y < -b.rect.h || b.rect.y > 720 || b.rect.x < 0 || b.rect.x > 1280;
-            }),
-        bullets.end());
+void Turtle::fireRadial(EnemyProjectiles& projectiles)
+{
+    // Evenly spaced ring, offset by the spiral angle so repeated rings don't overlap exactly
+    fireVolley(projectiles, patternAngle, 2.0f * M_PI / patternBullets);
+    patternAngle += SPIRAL_STEP * 0.5f;
+}
+
+void Turtle::fireSpiral(EnemyProjectiles& projectiles)
+{
+    // One bullet per arm, then rotate the arms for the next volley
+    fireVolley(projectiles, patternAngle, 2.0f * M_PI / patternBullets);
+    patternAngle += SPIRAL_STEP;
 }
 
 void Turtle::hideinShell(Frog& player)
@@ -153,26 +226,17 @@ void Turtle::hideinShell(Frog& player)
     }
 }
 
-void Turtle::spawnTurtles(vector<Turtle> &turtles, int frameCount, SDL_Texture* turtleTexture, SDL_Renderer* renderer, int maxTurts)
+void Turtle::spawnTurtle(EntityPool<Turtle> &turtles, int x, int y, SDL_Texture* turtleTexture, SDL_Renderer* renderer)
 {
-    if (frameCount % 500 == 0) 
-    {
-        if (turtCounter < maxTurts || maxTurts == 0) // Override limit with maxTurts = 0
-        {
-            SDL_Rect newRect = { rand() % (1280 - 50), rand() % (720 - 50), 32 * 3, 19 * 3 };
-            
-            // Reserve space in the vector before adding new element
-            turtles.reserve(turtles.size() + 1);
-            
-            // Create turtle directly in the vector
-            turtles.emplace_back(newRect, false, 0, 0, turtleTexture);
-            
-            // Initialize health bar for the newly added turtle
-            if (renderer) {
-                turtles.back().initHealthBar(renderer);
-            }
-            
-            turtCounter++;
-        }
+    // Where and when is up to the SpawnDirector; a full pool just skips the spawn
+    Turtle* turtle = turtles.acquire();
+    if (!turtle) return;
+
+    SDL_Rect newRect = { x, y, 32 * 3, 19 * 3 };
+    turtle->reset(newRect, turtleTexture);
+    
+    // Initialize health bar for the newly added turtle
+    if (renderer) {
+        turtle->initHealthBar(renderer);
     }
 }
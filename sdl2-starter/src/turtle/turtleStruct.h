@@ -3,12 +3,23 @@
 
 #include <SDL2/SDL.h>
 #include <vector>
-#include "turtBullet/bulletStruct.h"
+#include <random>
+#include "turtBullet/EnemyProjectiles.h"
 #include "../frog/frogClass.h"
+#include "../terrain/FlowField.h"
+#include "../ai/AIScheduler.h"
+#include "../EntityPool.h"
 #include "../healthBar.cpp"
 
 using namespace std;
 
+// How a turtle shoots when its bullet timer fires
+enum class FirePattern {
+    AIMED,   // one bullet straight at the frog
+    RADIAL,  // a ring of bullets in every direction
+    SPIRAL   // a few arms that rotate a little every volley
+};
+
 struct Turtle
 {
     SDL_Rect rect;
@@ -20,24 +31,31 @@ struct Turtle
     bool facingRight;
     int turtmoveTimer;     
     int moveDuration;
-    healthBar* health;
+    healthBar health;      // Held by value so pooled turtles never allocate
     bool pendingRemoval;  // New flag to handle delayed removal
     float hurtTimer;
-    static int turtCounter;
-
+    FirePattern firePattern;
+    int fireInterval;      // frames between volleys
+    int patternBullets;    // bullets per RADIAL volley, arms per SPIRAL volley
+    float patternAngle;    // current SPIRAL rotation in radians
+    AIState ai;            // When this turtle last checked the frog's distance
+    static const int MAX_HEALTH = 50;
+
+    Turtle();
     Turtle(SDL_Rect r, bool hiding, float dx, float dy, SDL_Texture* tex);
 
+    // Bring a recycled pool slot back as a fresh turtle
+    void reset(SDL_Rect r, SDL_Texture* tex);
+
     // Copy constructor
     Turtle(const Turtle& other) : 
         rect(other.rect), texture(other.texture), up(other.up), down(other.down),
         left(other.left), right(other.right), hiding(other.hiding), dx(other.dx),
         dy(other.dy), bulletTimer(other.bulletTimer), facingRight(other.facingRight),
         turtmoveTimer(other.turtmoveTimer), moveDuration(other.moveDuration), 
-        hurtTimer(other.hurtTimer), health(nullptr), pendingRemoval(other.pendingRemoval) {
-        if (other.health) {
-            health = new healthBar(*other.health);
-        }
-    }
+        hurtTimer(other.hurtTimer), health(other.health), pendingRemoval(other.pendingRemoval),
+        firePattern(other.firePattern), fireInterval(other.fireInterval),
+        patternBullets(other.patternBullets), patternAngle(other.patternAngle), ai(other.ai) {}
 
     // Move constructor
     Turtle(Turtle&& other) noexcept :
@@ -45,9 +63,10 @@ struct Turtle
         left(other.left), right(other.right), hiding(other.hiding), dx(other.dx),
         dy(other.dy), bulletTimer(other.bulletTimer), facingRight(other.facingRight),
         turtmoveTimer(other.turtmoveTimer), moveDuration(other.moveDuration), 
-        hurtTimer(other.hurtTimer), health(other.health), 
-        pendingRemoval(other.pendingRemoval) {
-        other.health = nullptr;  // Transfer ownership
+        hurtTimer(other.hurtTimer), health(std::move(other.health)), 
+        pendingRemoval(other.pendingRemoval), firePattern(other.firePattern),
+        fireInterval(other.fireInterval), patternBullets(other.patternBullets),
+        patternAngle(other.patternAngle), ai(other.ai) {
         other.texture = nullptr;
     }
 
@@ -69,10 +88,13 @@ struct Turtle
             moveDuration = other.moveDuration;
             pendingRemoval = other.pendingRemoval;
             hurtTimer = other.hurtTimer;
+            firePattern = other.firePattern;
+            fireInterval = other.fireInterval;
+            patternBullets = other.patternBullets;
+            patternAngle = other.patternAngle;
+            ai = other.ai;
 
-            // Handle health bar
-            delete health;
-            health = other.health ? new healthBar(*other.health) : nullptr;
+            health = other.health;
         }
         return *this;
     }
@@ -95,44 +117,40 @@ struct Turtle
             moveDuration = other.moveDuration;
             pendingRemoval = other.pendingRemoval;
             hurtTimer = other.hurtTimer;
+            firePattern = other.firePattern;
+            fireInterval = other.fireInterval;
+            patternBullets = other.patternBullets;
+            patternAngle = other.patternAngle;
+            ai = other.ai;
 
-            // Handle health bar
-            delete health;
-            health = other.health;
-            other.health = nullptr;
+            health = std::move(other.health);
             other.texture = nullptr;
         }
         return *this;
     }
 
     void initHealthBar(SDL_Renderer* renderer) {
-        if (!health) {
-            health = new healthBar(renderer, 50);
-        }
+        health = healthBar(renderer, MAX_HEALTH);
     }
 
     void takeDamage(int amount) {
-        if (health) {
-            health->damage(amount);
-            if (health->getHealth() <= 0) {
-                pendingRemoval = true;  // Mark for removal instead of immediate hiding
-                if (health) {
-                    health->setVisible(false);  // Hide the health bar
-                }
-                hiding = true;  // Hide in shell when health is depleted
-            }
+        health.damage(amount);
+        if (health.getHealth() <= 0) {
+            pendingRemoval = true;  // Mark for removal instead of immediate hiding
+            health.setVisible(false);  // Hide the health bar
+            hiding = true;  // Hide in shell when health is depleted
         }
     }
 
     void updateHealthBar() {
-        if (health && !hiding && !pendingRemoval) {
-            health->setPosition(rect.x + rect.w/2, rect.y);
+        if (!hiding && !pendingRemoval) {
+            health.setPosition(rect.x + rect.w/2, rect.y);
         }
     }
 
     void renderHealthBar(SDL_Renderer* renderer) {
-        if (health && !hiding && !pendingRemoval) {
-            health->draw();
+        if (!hiding && !pendingRemoval) {
+            health.draw();
         }
     }
 
@@ -140,14 +158,21 @@ struct Turtle
         return pendingRemoval;
     }
 
-    ~Turtle() {
-        delete health;
+    void setFirePattern(FirePattern pattern, int interval, int bulletsPerVolley) {
+        firePattern = pattern;
+        fireInterval = interval;
+        patternBullets = bulletsPerVolley;
     }
 
-    void updateMovement();
-    void fireBullet(vector<Bullet>& bullets, Frog& player, float deltaTime, SDL_Renderer* renderer, SDL_Texture* bulletTexture);
+    // rng drives the random walk used without a flow field (the world's own)
+    void updateMovement(const FlowField* flowField, std::mt19937& rng);
+    void fireBullet(EnemyProjectiles& projectiles, Frog& player);
+    void fireRadial(EnemyProjectiles& projectiles);
+    void fireSpiral(EnemyProjectiles& projectiles);
+    // patternBullets bullets from the turtle's center, angleStep radians apart starting at baseAngle
+    void fireVolley(EnemyProjectiles& projectiles, float baseAngle, float angleStep);
     void hideinShell(Frog& player);
-    static void spawnTurtles(vector<Turtle>& turtles, int frameCount, SDL_Texture* turtleTexture, SDL_Renderer* renderer, int maxTurts);
+    static void spawnTurtle(EntityPool<Turtle>& turtles, int x, int y, SDL_Texture* turtleTexture, SDL_Renderer* renderer);
 };
 
 #endif
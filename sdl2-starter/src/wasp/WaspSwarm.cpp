@@ -0,0 +1,223 @@
+#include "WaspSwarm.h"
+#include <cmath>
+#include <algorithm>
+
+namespace {
+
+// Add one neighbor j to every agent of a cell. The cell's agents are contiguous,
+// so this is a plain loop over arrays with selects instead of branches and one
+// accumulator per agent, which lets the compiler vectorize it. Pointers are
+// restrict parameters because that is where GCC and Clang honour the promise.
+void accumulateFrom(int agents, const float* __restrict x, const float* __restrict y,
+                    float* __restrict sepX, float* __restrict sepY,
+                    float* __restrict alignX, float* __restrict alignY,
+                    float* __restrict cohX, float* __restrict cohY, float* __restrict neighbors,
+                    float xj, float yj, float vxj, float vyj,
+                    float weight, float neighborSq, float separationSq) {
+    for (int i = 0; i < agents; i++) {
+        float dx = x[i] - xj;
+        float dy = y[i] - yj;
+        float distSq = dx * dx + dy * dy;
+        float notSelf = distSq > 0.0f ? weight : 0.0f;
+        float inRange = distSq < neighborSq ? notSelf : 0.0f;
+        float inSeparation = distSq < separationSq ? notSelf : 0.0f;
+        float push = inSeparation / (distSq + 1.0f);
+
+        sepX[i] += dx * push;
+        sepY[i] += dy * push;
+        alignX[i] += vxj * inRange;
+        alignY[i] += vyj * inRange;
+        cohX[i] += xj * inRange;
+        cohY[i] += yj * inRange;
+        neighbors[i] += inRange;
+    }
+}
+
+} // namespace
+
+WaspSwarm::WaspSwarm(int capacity, int width, int height, const SwarmParams& swarmParams)
+    : params(swarmParams), maxAgents(capacity), count(0), worldWidth(width), worldHeight(height) {
+    // Cells as wide as the neighbor radius, so a 3x3 block covers every neighbor
+    cellSize = params.neighborRadius;
+    gridWidth = static_cast<int>(std::ceil(worldWidth / cellSize)) + 1;
+    gridHeight = static_cast<int>(std::ceil(worldHeight / cellSize)) + 1;
+
+    // Everything is sized here; update() never allocates
+    posX.resize(maxAgents);
+    posY.resize(maxAgents);
+    velX.resize(maxAgents);
+    velY.resize(maxAgents);
+    agentCell.resize(maxAgents);
+    sortedToAgent.resize(maxAgents);
+    cellStart.resize(gridWidth * gridHeight);
+    cellCount.resize(gridWidth * gridHeight);
+
+    sortedX.resize(maxAgents);
+    sortedY.resize(maxAgents);
+    sortedVX.resize(maxAgents);
+    sortedVY.resize(maxAgents);
+    sepX.resize(maxAgents);
+    sepY.resize(maxAgents);
+    alignX.resize(maxAgents);
+    alignY.resize(maxAgents);
+    cohX.resize(maxAgents);
+    cohY.resize(maxAgents);
+    neighbors.resize(maxAgents);
+}
+
+int WaspSwarm::add(float x, float y, float vx, float vy) {
+    if (count >= maxAgents) return -1;
+    posX[count] = x;
+    posY[count] = y;
+    velX[count] = vx;
+    velY[count] = vy;
+    return count++;
+}
+
+void WaspSwarm::buildGrid() {
+    std::fill(cellCount.begin(), cellCount.end(), 0);
+
+    // Count agents per cell
+    for (int i = 0; i < count; i++) {
+        int cx = std::min(std::max(static_cast<int>(posX[i] / cellSize), 0), gridWidth - 1);
+        int cy = std::min(std::max(static_cast<int>(posY[i] / cellSize), 0), gridHeight - 1);
+        int cell = cy * gridWidth + cx;
+        agentCell[i] = cell;
+        cellCount[cell]++;
+    }
+
+    // Prefix sum gives each cell its start in the sorted arrays
+    int running = 0;
+    for (size_t c = 0; c < cellStart.size(); c++) {
+        cellStart[c] = running;
+        running += cellCount[c];
+    }
+
+    // Scatter agents into cell order (reusing cellCount as a fill cursor)
+    std::fill(cellCount.begin(), cellCount.end(), 0);
+    for (int i = 0; i < count; i++) {
+        int cell = agentCell[i];
+        int slot = cellStart[cell] + cellCount[cell]++;
+        sortedToAgent[slot] = i;
+        sortedX[slot] = posX[i];
+        sortedY[slot] = posY[i];
+        sortedVX[slot] = velX[i];
+        sortedVY[slot] = velY[i];
+    }
+}
+
+void WaspSwarm::accumulateNeighbors() {
+    const float neighborSq = params.neighborRadius * params.neighborRadius;
+    const float separationSq = params.separationRadius * params.separationRadius;
+
+    std::fill(sepX.begin(), sepX.begin() + count, 0.0f);
+    std::fill(sepY.begin(), sepY.begin() + count, 0.0f);
+    std::fill(alignX.begin(), alignX.begin() + count, 0.0f);
+    std::fill(alignY.begin(), alignY.begin() + count, 0.0f);
+    std::fill(cohX.begin(), cohX.begin() + count, 0.0f);
+    std::fill(cohY.begin(), cohY.begin() + count, 0.0f);
+    std::fill(neighbors.begin(), neighbors.begin() + count, 0.0f);
+
+    for (int gy = 0; gy < gridHeight; gy++) {
+        for (int gx = 0; gx < gridWidth; gx++) {
+            int cell = gy * gridWidth + gx;
+            const int agents = cellCount[cell];
+            if (agents == 0) continue;
+            const int begin = cellStart[cell];
+
+            // Every agent in this cell against the agents in the 3x3 block around it
+            for (int ny = std::max(gy - 1, 0); ny <= std::min(gy + 1, gridHeight - 1); ny++) {
+                for (int nx = std::max(gx - 1, 0); nx <= std::min(gx + 1, gridWidth - 1); nx++) {
+                    int other = ny * gridWidth + nx;
+                    const int otherCount = cellCount[other];
+                    if (otherCount == 0) continue;
+
+                    // Read at most maxSamplesPerCell agents spread across a crowded
+                    // cell and weight each one so the cell still counts in full
+                    const int samples = std::min(otherCount, params.maxSamplesPerCell);
+                    const int stride = otherCount / samples;
+                    const float weight = static_cast<float>(otherCount) / samples;
+
+                    for (int k = 0; k < samples; k++) {
+                        const int j = cellStart[other] + k * stride;
+                        const float xj = sortedX[j];
+                        const float yj = sortedY[j];
+                        const float vxj = sortedVX[j];
+                        const float vyj = sortedVY[j];
+
+                        accumulateFrom(agents, &sortedX[begin], &sortedY[begin],
+                                       &sepX[begin], &sepY[begin], &alignX[begin], &alignY[begin],
+                                       &cohX[begin], &cohY[begin], &neighbors[begin],
+                                       xj, yj, vxj, vyj, weight, neighborSq, separationSq);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void WaspSwarm::steer(float deltaTime, float targetX, float targetY) {
+    const float maxSpeed = params.maxSpeed;
+    const float maxForce = params.maxForce;
+    const float maxX = static_cast<float>(worldWidth);
+    const float maxY = static_cast<float>(worldHeight);
+
+    // One straight pass over every agent, in sorted order
+    for (int i = 0; i < count; i++) {
+        float x = sortedX[i];
+        float y = sortedY[i];
+        float vx = sortedVX[i];
+        float vy = sortedVY[i];
+
+        // Seek: steer toward full speed in the target's direction
+        float toX = targetX - x;
+        float toY = targetY - y;
+        float invDist = 1.0f / (std::sqrt(toX * toX + toY * toY) + 0.001f);
+        float forceX = (toX * invDist * maxSpeed - vx) * params.seekWeight;
+        float forceY = (toY * invDist * maxSpeed - vy) * params.seekWeight;
+
+        // Alignment and cohesion use the neighbor averages (zero when alone)
+        float invCount = neighbors[i] > 0.0f ? 1.0f / neighbors[i] : 0.0f;
+        float hasNeighbors = neighbors[i] > 0.0f ? 1.0f : 0.0f;
+        forceX += (alignX[i] * invCount - vx * hasNeighbors) * params.alignmentWeight;
+        forceY += (alignY[i] * invCount - vy * hasNeighbors) * params.alignmentWeight;
+        forceX += (cohX[i] * invCount - x * hasNeighbors) * params.cohesionWeight;
+        forceY += (cohY[i] * invCount - y * hasNeighbors) * params.cohesionWeight;
+
+        // Separation
+        forceX += sepX[i] * params.separationStrength;
+        forceY += sepY[i] * params.separationStrength;
+
+        // Clamp force, then speed
+        float forceLen = std::sqrt(forceX * forceX + forceY * forceY);
+        float forceScale = std::min(1.0f, maxForce / (forceLen + 0.001f));
+        vx += forceX * forceScale * deltaTime;
+        vy += forceY * forceScale * deltaTime;
+
+        float speed = std::sqrt(vx * vx + vy * vy);
+        float speedScale = std::min(1.0f, maxSpeed / (speed + 0.001f));
+        vx *= speedScale;
+        vy *= speedScale;
+
+        sortedVX[i] = vx;
+        sortedVY[i] = vy;
+        sortedX[i] = std::min(std::max(x + vx * deltaTime, 0.0f), maxX);
+        sortedY[i] = std::min(std::max(y + vy * deltaTime, 0.0f), maxY);
+    }
+
+    // Back to insertion order so callers can match agents to their wasps
+    for (int i = 0; i < count; i++) {
+        int agent = sortedToAgent[i];
+        posX[agent] = sortedX[i];
+        posY[agent] = sortedY[i];
+        velX[agent] = sortedVX[i];
+        velY[agent] = sortedVY[i];
+    }
+}
+
+void WaspSwarm::update(float deltaTime, float targetX, float targetY) {
+    if (count == 0) return;
+    buildGrid();
+    accumulateNeighbors();
+    steer(deltaTime, targetX, targetY);
+}
@@ -6,11 +6,37 @@
 
 using namespace std;
 
+Wasp::Wasp()
+    : rect({0, 0, 0, 0}), texture(nullptr), dx(0.0f), dy(0.0f), left(0), right(0), active(false),
+      facingRight(false), health(nullptr, MAX_HEALTH), pendingRemoval(false), damageTimer(0.0f) {}
+
 Wasp::Wasp(SDL_Rect r, float dx, float dy, SDL_Texture* tex)
     : rect(r), texture(tex), dx(dx), dy(dy), left(0), right(0), active(true), 
-      facingRight(false), health(nullptr), pendingRemoval(false), damageTimer(0.0f) {}
+      facingRight(false), health(nullptr, MAX_HEALTH), pendingRemoval(false), damageTimer(0.0f) {}
+
+void Wasp::reset(SDL_Rect r, SDL_Texture* tex)
+{
+    rect = r;
+    texture = tex;
+    dx = 0.0f;
+    dy = 0.0f;
+    left = 0;
+    right = 0;
+    active = true;
+    facingRight = false;
+    health = healthBar(nullptr, MAX_HEALTH);
+    pendingRemoval = false;
+    damageTimer = 0.0f;
+    ai = AIState();
+}
 
 void Wasp::moveTowards(Frog& player, int speed)
+{
+    think(player, speed);
+    integrate();
+}
+
+void Wasp::think(Frog& player, int speed)
 {
     if (pendingRemoval) return;  // Don't move if pending removal
 
@@ -24,9 +50,6 @@ void Wasp::moveTowards(Frog& player, int speed)
         // Calculate direction and apply speed
         dx = (static_cast<float>(speed) * deltaX) / magnitude;
         dy = (static_cast<float>(speed) * deltaY) / magnitude;
-
-        rect.x = static_cast<int>(rect.x + dx);
-        rect.y = static_cast<int>(rect.y + dy);
     }
 
     if (dx > 0)
@@ -39,47 +62,26 @@ void Wasp::moveTowards(Frog& player, int speed)
     }
 }
 
-void Wasp::spawnWasps(vector<Wasp>& wasps, int frameCount, SDL_Texture* waspTexture, SDL_Renderer* renderer)
+void Wasp::integrate()
 {
-    if (frameCount % 300 == 0)  // Spawn every 300 frames
-    {
-        // Create a new wasp at a random position along the edges
-        int x, y;
-        int side = rand() % 4;  // 0: top, 1: right, 2: bottom, 3: left
+    if (pendingRemoval) return;
 
-        switch (side) {
-            case 0:  // top
-                x = rand() % 1280;
-                y = 0;
-                break;
-            case 1:  // right
-                x = 1280;
-                y = rand() % 720;
-                break;
-            case 2:  // bottom
-                x = rand() % 1280;
-                y = 720 - (16 * 3); // Spawn them in view
-                break;
-            case 3:  // left
-                x = 16 * 3; // Spawn them in view
-                y = rand() % 720;
-                break;
-            default:
-                x = 0;
-                y = 0;
-        }
+    // Keep flying on the last heading between decisions
+    rect.x = static_cast<int>(rect.x + dx);
+    rect.y = static_cast<int>(rect.y + dy);
+}
+
+void Wasp::spawnWasp(EntityPool<Wasp>& wasps, int x, int y, SDL_Texture* waspTexture, SDL_Renderer* renderer)
+{
+    // Where and when is up to the SpawnDirector; a full pool just skips the spawn
+    Wasp* wasp = wasps.acquire();
+    if (!wasp) return;
 
-        SDL_Rect waspRect = { x, y, 16 * 3, 16 * 3 };  // scale up image size by three
-        
-        // Reserve space in the vector before adding new element
-        wasps.reserve(wasps.size() + 1);
-        
-        // Create wasp directly in the vector
-        wasps.emplace_back(waspRect, 0.0f, 0.0f, waspTexture);
-        
-        // Initialize health bar for the newly added wasp
-        if (renderer) {
-            wasps.back().initHealthBar(renderer);
-        }
+    SDL_Rect waspRect = { x, y, 16 * 3, 16 * 3 };  // scale up image size by three
+    wasp->reset(waspRect, waspTexture);
+    
+    // Initialize health bar for the newly added wasp
+    if (renderer) {
+        wasp->initHealthBar(renderer);
     }
 }
@@ -5,6 +5,8 @@
 #include <vector>
 #include "../frog/frogClass.h"
 #include "../healthBar.cpp"
+#include "../ai/AIScheduler.h"
+#include "../EntityPool.h"
 #include <SDL2/SDL_image.h>
 using namespace std;
 
@@ -16,31 +18,32 @@ struct Wasp
     int left, right;
     bool active;
     bool facingRight;
-    healthBar* health;
+    healthBar health;     // Held by value so pooled wasps never allocate
     bool pendingRemoval;  // New flag to handle delayed removal
     float damageTimer;    // Timer for damage cooldown
+    AIState ai;           // When this wasp last picked a heading
     static constexpr float DAMAGE_COOLDOWN = 1.5f; // Cooldown in seconds
+    static const int MAX_HEALTH = 20;
 
+    Wasp();
     Wasp(SDL_Rect r, float dx, float dy, SDL_Texture* tex);
 
+    // Bring a recycled pool slot back as a fresh wasp
+    void reset(SDL_Rect r, SDL_Texture* tex);
+
     // Copy constructor
     Wasp(const Wasp& other) : 
         rect(other.rect), texture(other.texture), dx(other.dx), dy(other.dy),
         left(other.left), right(other.right), active(other.active),
-        facingRight(other.facingRight), health(nullptr), pendingRemoval(other.pendingRemoval),
-        damageTimer(other.damageTimer) {
-        if (other.health) {
-            health = new healthBar(*other.health);
-        }
-    }
+        facingRight(other.facingRight), health(other.health), pendingRemoval(other.pendingRemoval),
+        damageTimer(other.damageTimer), ai(other.ai) {}
 
     // Move constructor
     Wasp(Wasp&& other) noexcept :
         rect(other.rect), texture(other.texture), dx(other.dx), dy(other.dy),
         left(other.left), right(other.right), active(other.active),
-        facingRight(other.facingRight), health(other.health), pendingRemoval(other.pendingRemoval),
-        damageTimer(other.damageTimer) {
-        other.health = nullptr;  // Transfer ownership
+        facingRight(other.facingRight), health(std::move(other.health)), pendingRemoval(other.pendingRemoval),
+        damageTimer(other.damageTimer), ai(other.ai) {
         other.texture = nullptr;
     }
 
@@ -57,10 +60,9 @@ struct Wasp
             facingRight = other.facingRight;
             pendingRemoval = other.pendingRemoval;
             damageTimer = other.damageTimer;
+            ai = other.ai;
 
-            // Handle health bar
-            delete health;
-            health = other.health ? new healthBar(*other.health) : nullptr;
+            health = other.health;
         }
         return *this;
     }
@@ -78,43 +80,35 @@ struct Wasp
             facingRight = other.facingRight;
             pendingRemoval = other.pendingRemoval;
             damageTimer = other.damageTimer;
+            ai = other.ai;
 
-            // Handle health bar
-            delete health;
-            health = other.health;
-            other.health = nullptr;
+            health = std::move(other.health);
             other.texture = nullptr;
         }
         return *this;
     }
     
     void initHealthBar(SDL_Renderer* renderer) {
-        if (!health) {
-            health = new healthBar(renderer, 20);
-        }
+        health = healthBar(renderer, MAX_HEALTH);
     }
 
     void takeDamage(int amount) {
-        if (health) {
-            health->damage(amount);
-            if (health->getHealth() <= 0) {
-                pendingRemoval = true;  // Mark for removal instead of immediate deactivation
-                if (health) {
-                    health->setVisible(false);  // Hide the health bar
-                }
-            }
+        health.damage(amount);
+        if (health.getHealth() <= 0) {
+            pendingRemoval = true;  // Mark for removal instead of immediate deactivation
+            health.setVisible(false);  // Hide the health bar
         }
     }
 
     void updateHealthBar() {
-        if (health && active && !pendingRemoval) {
-            health->setPosition(rect.x + rect.w/2, rect.y);
+        if (active && !pendingRemoval) {
+            health.setPosition(rect.x + rect.w/2, rect.y);
         }
     }
 
     void renderHealthBar(SDL_Renderer* renderer) {
-        if (health && active && !pendingRemoval) {
-            health->draw();
+        if (active && !pendingRemoval) {
+            health.draw();
         }
     }
 
@@ -139,12 +133,10 @@ struct Wasp
         return pendingRemoval;
     }
 
-    ~Wasp() {
-        delete health;
-    }
-    
     void moveTowards(Frog& player, int speed);
-    static void spawnWasps(vector<Wasp>& wasps, int frameCount, SDL_Texture* waspTexture, SDL_Renderer* renderer);
+    void think(Frog& player, int speed);  // pick a heading toward the frog
+    void integrate();                     // move along the current heading
+    static void spawnWasp(EntityPool<Wasp>& wasps, int x, int y, SDL_Texture* waspTexture, SDL_Renderer* renderer);
 };
 
 #endif
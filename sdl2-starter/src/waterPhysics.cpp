@@ -1,19 +1,37 @@
 #include "waterPhysics.h"
 
-WaterPhysics::WaterPhysics(SDL_Renderer* renderer) {
-    // Load textures
-    waterRingTexture = IMG_LoadTexture(renderer, "assets/waterRing.png");
-    smallWaterRingTexture = IMG_LoadTexture(renderer, "assets/smallWaterRing.png");
+static const char* const WATER_RING_PATH = "assets/waterRing.png";
+static const char* const SMALL_WATER_RING_PATH = "assets/smallWaterRing.png";
+
+WaterPhysics::WaterPhysics(SDL_Renderer* renderer, uint32_t seed)
+    : waterRingWidth(0), smallWaterRingWidth(0),
+      rainRings(MAX_RAIN_RINGS, ParticleShape::SPRITE),
+      frogRings(MAX_FROG_RINGS, ParticleShape::SPRITE),
+      spawnEmitter(1.0f / SPAWN_INTERVAL), batch(256) {
+    // Load textures (the menu and the game share one copy through the AssetManager)
+    if (renderer) {
+        AssetManager* assets = AssetManager::getInstance();
+        waterRingTexture = assets->getTexture(renderer, WATER_RING_PATH);
+        smallWaterRingTexture = assets->getTexture(renderer, SMALL_WATER_RING_PATH);
+    }
+
+    // Rings are drawn as squares sized from the texture width
+    if (waterRingTexture) {
+        SDL_QueryTexture(waterRingTexture.get(), nullptr, nullptr, &waterRingWidth, nullptr);
+    }
+    if (smallWaterRingTexture) {
+        SDL_QueryTexture(smallWaterRingTexture.get(), nullptr, nullptr, &smallWaterRingWidth, nullptr);
+    }
+    frogRings.setTexture(waterRingTexture.get());
+    rainRings.setTexture(smallWaterRingTexture.get());
     
     // Initialize random number generator
-    rng.seed(std::time(nullptr));
-    spawnTimer = 0.0f;
+    rng.seed(seed != 0 ? seed : static_cast<uint32_t>(std::time(nullptr)));
     frogRingTimer = 0.0f;
 }
 
 WaterPhysics::~WaterPhysics() {
-    SDL_DestroyTexture(waterRingTexture);
-    SDL_DestroyTexture(smallWaterRingTexture);
+    // Ring textures are released with their handles
 }
 
 void WaterPhysics::addFrogRing(float x, float y) {
@@ -22,7 +40,13 @@ void WaterPhysics::addFrogRing(float x, float y) {
         // Randomly decide whether to spawn a ring
         std::uniform_real_distribution<float> dist(0.0f, 1.0f);
         if (dist(rng) < 0.3f) {  // 30% chance to spawn a ring
-            activeRings.emplace_back(x, y, false);
+            ParticleParams ring;
+            ring.x = x;
+            ring.y = y;
+            ring.lifetime = RING_LIFETIME;
+            ring.width = ring.height = waterRingWidth * RING_START_SCALE;
+            ring.growth = waterRingWidth * 3.0f;  // Scale up over time
+            frogRings.emit(ring);
         }
         frogRingTimer = 0.0f;
     }
@@ -30,77 +54,45 @@ void WaterPhysics::addFrogRing(float x, float y) {
 
 void WaterPhysics::update(float deltaTime, const TerrainGrid& terrain) {
     // Update timers
-    spawnTimer += deltaTime;
     frogRingTimer += deltaTime;
     
-    // Update existing rings
-    for (auto it = activeRings.begin(); it != activeRings.end();) {
-        it->lifetime += deltaTime;
-        
-        // Scale up over time
-        it->scale += deltaTime * (it->isSmall ? 1.5f : 3.0f);
-        
-        // Fade out over time
-        it->alpha = std::max(0.0f, 1.0f - (it->lifetime / 1.0f));
-        
-        // Remove rings that have completed their animation
-        if (it->lifetime >= 1.0f) {
-            it = activeRings.erase(it);
-        } else {
-            ++it;
-        }
-    }
+    // Grow, fade out and remove rings that have completed their animation
+    rainRings.update(deltaTime);
+    frogRings.update(deltaTime);
     
     // Spawn random rain rings on water tiles
-    if (spawnTimer >= SPAWN_INTERVAL) {
-        spawnTimer = 0.0f;
-        
+    int bursts = spawnEmitter.due(deltaTime);
+    if (bursts > 0) {
         // Get grid dimensions
         int gridWidth = terrain.getWidth();
         int gridHeight = terrain.getHeight();
+
+        std::uniform_int_distribution<int> distX(0, gridWidth - 1);
+        std::uniform_int_distribution<int> distY(0, gridHeight - 1);
+        std::uniform_real_distribution<float> chanceDist(0.0f, 1.0f);
+
+        ParticleParams ring;
+        ring.lifetime = RING_LIFETIME;
+        ring.width = ring.height = smallWaterRingWidth * RING_START_SCALE;
+        ring.growth = smallWaterRingWidth * 1.5f;
         
         // Try to spawn multiple rings per interval
-        for (int i = 0; i < 150; i++) {  // Attempt to spawn up to 150 rings per interval
-            std::uniform_int_distribution<int> distX(0, gridWidth - 1);
-            std::uniform_int_distribution<int> distY(0, gridHeight - 1);
-            
+        for (int i = 0; i < 150 && !rainRings.full(); i++) {  // Attempt to spawn up to 150 rings per interval
             int x = distX(rng);
             int y = distY(rng);
             
             // If the selected tile is water, spawn a ring with 50% chance
-            if (terrain.isWater(x, y)) {
-                std::uniform_real_distribution<float> chanceDist(0.0f, 1.0f);
-                if (chanceDist(rng) < 0.5f) {  // 50% chance to spawn
-                    float worldX = x * terrain.getCellSize();
-                    float worldY = y * terrain.getCellSize();
-                    activeRings.emplace_back(worldX, worldY, true);
-                }
+            if (terrain.isWater(x, y) && chanceDist(rng) < 0.5f) {
+                ring.x = static_cast<float>(x * terrain.getCellSize());
+                ring.y = static_cast<float>(y * terrain.getCellSize());
+                rainRings.emit(ring);
             }
         }
     }
 }
 
 void WaterPhysics::render(SDL_Renderer* renderer) {
-    for (const auto& ring : activeRings) {
-        SDL_Texture* texture = ring.isSmall ? smallWaterRingTexture : waterRingTexture;
-        
-        // Get texture dimensions
-        int texWidth, texHeight;
-        SDL_QueryTexture(texture, nullptr, nullptr, &texWidth, &texHeight);
-        
-        // Calculate destination rectangle
-        int size = static_cast<int>(texWidth * ring.scale);
-        SDL_Rect dstRect = {
-            static_cast<int>(ring.x - size/2),
-            static_cast<int>(ring.y - size/2),
-            size,
-            size
-        };
-        
-        // Set alpha for transparency
-        SDL_SetTextureAlphaMod(texture, static_cast<Uint8>(255 * ring.alpha));
-        
-        // Render the ring
-        SDL_RenderCopy(renderer, texture, nullptr, &dstRect);
-    }
+    // One batched draw per ring texture; alpha comes from the vertex colours
+    rainRings.render(renderer, batch);
+    frogRings.render(renderer, batch);
 }
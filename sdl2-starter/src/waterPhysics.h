@@ -2,37 +2,41 @@
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_image.h>
 #include "terrain/TerrainGrid.h"
+#include "particles/ParticleSystem.h"
+#include "AssetManager.h"
 #include <random>
 #include <ctime>
-#include <vector>
-
-struct WaterRing {
-    float x, y;           // Position
-    float scale;          // Current scale
-    float alpha;          // Current transparency
-    float lifetime;       // Current lifetime
-    bool isSmall;        // Whether this is a small ring or regular ring
-    
-    WaterRing(float x, float y, bool small) 
-        : x(x), y(y), scale(0.3f), alpha(1.0f), lifetime(0.0f), isSmall(small) {}
-};
 
 class WaterPhysics {
 private:
-    SDL_Texture* waterRingTexture;
-    SDL_Texture* smallWaterRingTexture;
-    std::vector<WaterRing> activeRings;
+    TextureHandle waterRingTexture;       // Shared with every other WaterPhysics
+    TextureHandle smallWaterRingTexture;
+    int waterRingWidth;
+    int smallWaterRingWidth;
+    ParticlePool rainRings;   // Small rings from rain hitting water tiles
+    ParticlePool frogRings;   // Regular rings left behind by the frog
+    ParticleEmitter spawnEmitter;
+    QuadBatch batch;
     std::mt19937 rng;
-    float spawnTimer;
     float frogRingTimer;  // Added timer for frog ring spawning
-    const float SPAWN_INTERVAL = 0.1f;  // Increased spawn frequency (reduced from 0.5f to 0.1f)
-    const float FROG_RING_INTERVAL = 0.2f;  // Added interval for frog ring spawning
+    static constexpr float SPAWN_INTERVAL = 0.1f;  // Increased spawn frequency (reduced from 0.5f to 0.1f)
+    static constexpr float FROG_RING_INTERVAL = 0.2f;  // Added interval for frog ring spawning
+    static constexpr float RING_LIFETIME = 1.0f;
+    static constexpr float RING_START_SCALE = 0.3f;
+    static const int MAX_RAIN_RINGS = 1024;  // 150 tries * 50% per interval, 1 second lifetime
+    static const int MAX_FROG_RINGS = 16;
     
 public:
-    WaterPhysics(SDL_Renderer* renderer);
+    // Without a renderer (headless worlds) no textures are loaded; seed 0 picks one from the clock
+    WaterPhysics(SDL_Renderer* renderer, uint32_t seed = 0);
     ~WaterPhysics();
     
     void addFrogRing(float x, float y);
     void update(float deltaTime, const TerrainGrid& terrain);
     void render(SDL_Renderer* renderer);
+
+    int size() const { return rainRings.size() + frogRings.size(); }
+    size_t memoryBytes() const {
+        return rainRings.memoryBytes() + frogRings.memoryBytes() + batch.memoryBytes();
+    }
 };
@@ -0,0 +1,138 @@
+// Prints the live metrics a running game publishes with --metrics.
+//
+//   metricsreader [--once] [--json] [name]
+//
+// Maps the shared-memory segment read-only (default name /froggun-metrics,
+// the same one the game uses) and prints a snapshot each time the game
+// publishes one, about once a second, until interrupted or the game goes away.
+// --once prints the current snapshot and exits; --json prints one JSON object
+// per snapshot for piping into a dashboard. See src/MetricsFormat.h.
+
+#include "../src/MetricsFormat.h"
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+static const int POLL_MS = 100;
+static const int STALE_SECONDS = 5;  // no new snapshot for this long: the game is gone
+
+static volatile sig_atomic_t interrupted = 0;
+
+static void onInterrupt(int) {
+    interrupted = 1;
+}
+
+// Seqlock read: copy, then make sure no write started or finished meanwhile
+static bool readSnapshot(const MetricsSegment* segment, MetricsSnapshot& out) {
+    for (int attempt = 0; attempt < 1000; attempt++) {
+        uint32_t before = segment->sequence.load(std::memory_order_acquire);
+        if (before & 1) continue;
+        std::memcpy(&out, &segment->snapshot, sizeof(out));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (segment->sequence.load(std::memory_order_relaxed) == before) return true;
+    }
+    return false;
+}
+
+static void printText(const MetricsSnapshot& snapshot) {
+    printf("[%8.1fs] pid %d  %6.1f fps  frame ms mean %.2f p50 %.2f p95 %.2f p99 %.2f max %.2f  "
+           "allocs/s %.0f (%.1f KB/s)\n",
+           snapshot.uptimeSeconds, snapshot.pid, snapshot.fps, snapshot.frameMsMean, snapshot.frameMsP50,
+           snapshot.frameMsP95, snapshot.frameMsP99, snapshot.frameMsMax, snapshot.allocsPerSecond,
+           snapshot.allocBytesPerSecond / 1024.0);
+    if (snapshot.counterCount > 0) {
+        printf("            ");
+        for (int i = 0; i < snapshot.counterCount && i < METRICS_MAX_COUNTERS; i++) {
+            printf("%s%s %g", i == 0 ? "" : ", ", snapshot.counters[i].name, snapshot.counters[i].value);
+        }
+        printf("\n");
+    }
+}
+
+static void printJson(const MetricsSnapshot& snapshot) {
+    printf("{\"publish\": %llu, \"pid\": %d, \"uptime_s\": %.3f, \"interval_s\": %.3f, \"frames\": %llu, "
+           "\"fps\": %.2f, \"frame_ms\": {\"mean\": %.4f, \"p50\": %.4f, \"p95\": %.4f, \"p99\": %.4f, "
+           "\"max\": %.4f}, \"allocs_per_s\": %.1f, \"alloc_bytes_per_s\": %.1f, \"counts\": {",
+           static_cast<unsigned long long>(snapshot.publishCount), snapshot.pid, snapshot.uptimeSeconds,
+           snapshot.intervalSeconds, static_cast<unsigned long long>(snapshot.frames), snapshot.fps,
+           snapshot.frameMsMean, snapshot.frameMsP50, snapshot.frameMsP95, snapshot.frameMsP99,
+           snapshot.frameMsMax, snapshot.allocsPerSecond, snapshot.allocBytesPerSecond);
+    for (int i = 0; i < snapshot.counterCount && i < METRICS_MAX_COUNTERS; i++) {
+        printf("%s\"%s\": %g", i == 0 ? "" : ", ", snapshot.counters[i].name, snapshot.counters[i].value);
+    }
+    printf("}}\n");
+}
+
+int main(int argc, char* argv[]) {
+    bool once = false;
+    bool json = false;
+    std::string name = METRICS_DEFAULT_NAME;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--once") == 0) {
+            once = true;
+        } else if (std::strcmp(argv[i], "--json") == 0) {
+            json = true;
+        } else if (argv[i][0] == '/') {
+            name = argv[i];
+        } else {
+            fprintf(stderr, "usage: metricsreader [--once] [--json] [/shm-name]\n");
+            return 2;
+        }
+    }
+
+    int fd = shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd < 0) {
+        fprintf(stderr, "metricsreader: no metrics at %s (is the game running with --metrics?)\n", name.c_str());
+        return 1;
+    }
+    void* mapped = mmap(nullptr, sizeof(MetricsSegment), PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED) {
+        fprintf(stderr, "metricsreader: can't map %s\n", name.c_str());
+        return 1;
+    }
+    const MetricsSegment* segment = static_cast<const MetricsSegment*>(mapped);
+    if (std::memcmp(segment->magic, METRICS_MAGIC, sizeof(METRICS_MAGIC)) != 0 ||
+        segment->version != METRICS_VERSION) {
+        fprintf(stderr, "metricsreader: %s isn't a version %u metrics segment\n", name.c_str(), METRICS_VERSION);
+        return 1;
+    }
+
+    signal(SIGINT, onInterrupt);
+    signal(SIGTERM, onInterrupt);
+
+    uint64_t lastPublish = 0;
+    int idleMs = 0;
+    while (!interrupted) {
+        MetricsSnapshot snapshot = MetricsSnapshot();
+        if (readSnapshot(segment, snapshot) && snapshot.publishCount != lastPublish &&
+            snapshot.publishCount != 0) {
+            lastPublish = snapshot.publishCount;
+            idleMs = 0;
+            if (json) {
+                printJson(snapshot);
+            } else {
+                printText(snapshot);
+            }
+            fflush(stdout);
+            if (once) break;
+        } else if (once && snapshot.publishCount == 0) {
+            fprintf(stderr, "metricsreader: nothing published yet\n");
+            break;
+        }
+
+        usleep(POLL_MS * 1000);
+        idleMs += POLL_MS;
+        if (idleMs >= STALE_SECONDS * 1000) {
+            fprintf(stderr, "metricsreader: no update for %d seconds, stopping\n", STALE_SECONDS);
+            break;
+        }
+    }
+
+    munmap(mapped, sizeof(MetricsSegment));
+    return 0;
+}
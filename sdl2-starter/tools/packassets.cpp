@@ -0,0 +1,149 @@
+// Packs asset directories into one assets.pack for the game to memory-map.
+//
+//   packassets <out.pack> [-C <root>] <dir> [dir...] [-C <root> <dir>...]
+//
+// Every file under root/dir is stored under its path relative to root (the
+// current directory until the first -C), so
+// `packassets build/debug/assets.pack -C .. assets fonts` packs ../assets/wasp.png
+// as "assets/wasp.png", the same string the game loads it by. Several roots can
+// feed one pack, e.g. the PNGs from .. and their .rgba versions from build/debug/fast.
+// See src/AssetPackFormat.h for the layout.
+
+#include "../src/AssetPackFormat.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <dirent.h>
+#include <sys/stat.h>
+
+struct InputFile {
+    std::string name;  // path inside the pack
+    std::string path;  // path on disk
+    std::vector<char> bytes;
+};
+
+static bool readFile(const std::string& path, std::vector<char>& out) {
+    FILE* file = fopen(path.c_str(), "rb");
+    if (!file) return false;
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    out.resize(length > 0 ? length : 0);
+    bool ok = length >= 0 && fread(out.data(), 1, out.size(), file) == out.size();
+    fclose(file);
+    return ok;
+}
+
+// Collect every regular file under root/relative, skipping dotfiles
+static void collect(const std::string& root, const std::string& relative, std::vector<InputFile>& files) {
+    std::string dirPath = root + "/" + relative;
+    DIR* dir = opendir(dirPath.c_str());
+    if (!dir) {
+        fprintf(stderr, "packassets: can't open %s\n", dirPath.c_str());
+        return;
+    }
+    while (dirent* item = readdir(dir)) {
+        if (item->d_name[0] == '.') continue;
+
+        std::string name = relative + "/" + item->d_name;
+        std::string path = root + "/" + name;
+        struct stat info;
+        if (stat(path.c_str(), &info) != 0) continue;
+
+        if (S_ISDIR(info.st_mode)) {
+            collect(root, name, files);
+        } else if (S_ISREG(info.st_mode)) {
+            files.push_back({name, path, {}});
+        }
+    }
+    closedir(dir);
+}
+
+static uint64_t alignUp(uint64_t value) {
+    return (value + PACK_ALIGNMENT - 1) / PACK_ALIGNMENT * PACK_ALIGNMENT;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        fprintf(stderr, "usage: %s <out.pack> [-C <root>] <dir> [dir...]\n", argv[0]);
+        return 1;
+    }
+    std::string outPath = argv[1];
+    std::string root = ".";
+
+    std::vector<InputFile> files;
+    for (int i = 2; i < argc; i++) {
+        if (std::strcmp(argv[i], "-C") == 0 && i + 1 < argc) {
+            root = argv[++i];
+        } else {
+            collect(root, argv[i], files);
+        }
+    }
+    std::sort(files.begin(), files.end(),
+              [](const InputFile& a, const InputFile& b) { return a.name < b.name; });
+
+    // Two roots with the same file would make lookups ambiguous
+    for (size_t i = 1; i < files.size(); i++) {
+        if (files[i].name == files[i - 1].name) {
+            fprintf(stderr, "packassets: %s is in both %s and %s\n", files[i].name.c_str(),
+                    files[i - 1].path.c_str(), files[i].path.c_str());
+            return 1;
+        }
+    }
+
+    // Lay out the index, then the names, then each blob on an aligned offset
+    std::string names;
+    std::vector<PackEntry> entries(files.size());
+    for (size_t i = 0; i < files.size(); i++) {
+        if (!readFile(files[i].path, files[i].bytes)) {
+            fprintf(stderr, "packassets: can't read %s\n", files[i].path.c_str());
+            return 1;
+        }
+        PackEntry& entry = entries[i];
+        std::memset(&entry, 0, sizeof(entry));
+        entry.nameOffset = static_cast<uint32_t>(names.size());
+        entry.nameLength = static_cast<uint32_t>(files[i].name.size());
+        entry.size = files[i].bytes.size();
+        entry.kind = PACK_KIND_FILE;
+        names += files[i].name;
+    }
+
+    uint64_t offset = alignUp(sizeof(PackHeader) + entries.size() * sizeof(PackEntry) + names.size());
+    for (PackEntry& entry : entries) {
+        entry.offset = offset;
+        offset = alignUp(offset + entry.size);
+    }
+
+    PackHeader header;
+    std::memcpy(header.magic, PACK_MAGIC, sizeof(PACK_MAGIC));
+    header.version = PACK_VERSION;
+    header.entryCount = static_cast<uint32_t>(entries.size());
+    header.namesSize = static_cast<uint32_t>(names.size());
+
+    FILE* out = fopen(outPath.c_str(), "wb");
+    if (!out) {
+        fprintf(stderr, "packassets: can't write %s\n", outPath.c_str());
+        return 1;
+    }
+    fwrite(&header, sizeof(header), 1, out);
+    fwrite(entries.data(), sizeof(PackEntry), entries.size(), out);
+    fwrite(names.data(), 1, names.size(), out);
+
+    static const char zeros[PACK_ALIGNMENT] = {};
+    for (size_t i = 0; i < files.size(); i++) {
+        long padding = static_cast<long>(entries[i].offset) - ftell(out);
+        fwrite(zeros, 1, padding, out);
+        fwrite(files[i].bytes.data(), 1, files[i].bytes.size(), out);
+    }
+    bool ok = ferror(out) == 0;
+    ok = fclose(out) == 0 && ok;
+    if (!ok) {
+        fprintf(stderr, "packassets: error writing %s\n", outPath.c_str());
+        return 1;
+    }
+
+    printf("Packed %zu files (%.1f KB) into %s\n", files.size(), offset / 1024.0, outPath.c_str());
+    return 0;
+}
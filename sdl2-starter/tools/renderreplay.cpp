@@ -0,0 +1,412 @@
+// Plays back a render-command stream the game recorded with --record-render
+// (or F10) and times it on SDL's software and accelerated renderers.
+//
+//   renderreplay [--software] [--accelerated] [--loops 3] [--headless] [--json out.json] render.frs
+//
+// Without --software or --accelerated it runs both. Textures are same-sized
+// stand-ins (the stream keeps no pixels), so what's measured is the renderer's
+// cost for those draw calls, with no simulation or asset work in the frame. The
+// stream's own numbers (draw calls, texture switches) are printed too, for
+// comparing render path changes. --headless uses SDL's dummy video driver,
+// which only has the software renderer. See src/render/RenderStreamFormat.h.
+
+#include "../src/render/RenderStreamFormat.h"
+#include <SDL2/SDL.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+struct Frame {
+    RenderStreamFrame info;
+    std::vector<RenderCommand> commands;
+    std::vector<SDL_Vertex> vertices;
+    std::vector<int> indices;
+};
+
+struct Stream {
+    RenderStreamHeader header;
+    std::vector<RenderStreamTexture> textures;
+    std::vector<Frame> frames;
+};
+
+struct Timing {
+    std::string renderer;
+    bool ran = false;
+    double mean = 0.0, p50 = 0.0, p95 = 0.0, max = 0.0;
+};
+
+// Every texture a command names and every vertex and index range it draws has
+// to be in the stream, or replaying it would read past the end of a table
+static bool validFrame(const Frame& frame, uint32_t textureCount) {
+    uint64_t vertexEnd = 0, indexEnd = 0;
+    for (const RenderCommand& command : frame.commands) {
+        if (command.op >= RENDER_OP_COUNT) return false;
+        if (command.texture < -1 || command.texture >= static_cast<int64_t>(textureCount)) return false;
+        if (command.op != RENDER_OP_GEOMETRY) continue;
+
+        uint64_t firstIndex = indexEnd;
+        vertexEnd += command.vertexCount;
+        indexEnd += command.indexCount;
+        if (vertexEnd > frame.info.vertexCount || indexEnd > frame.info.indexCount) return false;
+        for (uint64_t i = firstIndex; i < indexEnd; i++) {
+            if (frame.indices[i] < 0 || static_cast<uint32_t>(frame.indices[i]) >= command.vertexCount) return false;
+        }
+    }
+    return true;
+}
+
+static bool load(const char* path, Stream& stream) {
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        fprintf(stderr, "renderreplay: can't open %s\n", path);
+        return false;
+    }
+    fseek(file, 0, SEEK_END);
+    long fileSize = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    bool ok = fread(&stream.header, sizeof(stream.header), 1, file) == 1 &&
+              std::memcmp(stream.header.magic, RENDER_STREAM_MAGIC, sizeof(RENDER_STREAM_MAGIC)) == 0 &&
+              stream.header.version >= 1 && stream.header.version <= RENDER_STREAM_VERSION;
+    if (!ok) {
+        fprintf(stderr, "renderreplay: %s isn't a version 1 to %u render stream\n", path, RENDER_STREAM_VERSION);
+        fclose(file);
+        return false;
+    }
+
+    // Counts are checked against what's left of the file before anything is sized from them
+    auto fits = [&](uint64_t bytes) {
+        long at = ftell(file);
+        return at >= 0 && bytes <= static_cast<uint64_t>(fileSize - at);
+    };
+
+    ok = fits(static_cast<uint64_t>(stream.header.textureCount) * sizeof(RenderStreamTexture));
+    if (ok) {
+        stream.textures.resize(stream.header.textureCount);
+        ok = stream.textures.empty() ||
+             fread(stream.textures.data(), sizeof(RenderStreamTexture), stream.textures.size(), file) == stream.textures.size();
+    }
+
+    bool valid = true;
+    std::vector<RenderStreamVertex> raw;
+    if (ok) {
+        ok = fits(static_cast<uint64_t>(stream.header.frameCount) * sizeof(RenderStreamFrame));
+    }
+    if (ok) {
+        stream.frames.resize(stream.header.frameCount);
+    }
+    for (Frame& frame : stream.frames) {
+        if (!ok || !valid) break;
+        ok = fread(&frame.info, sizeof(frame.info), 1, file) == 1 &&
+             fits(static_cast<uint64_t>(frame.info.commandCount) * sizeof(RenderCommand) +
+                  static_cast<uint64_t>(frame.info.vertexCount) * sizeof(RenderStreamVertex) +
+                  static_cast<uint64_t>(frame.info.indexCount) * sizeof(int32_t));
+        if (!ok) break;
+        frame.commands.resize(frame.info.commandCount);
+        raw.resize(frame.info.vertexCount);
+        frame.indices.resize(frame.info.indexCount);
+        ok = fread(frame.commands.data(), sizeof(RenderCommand), frame.commands.size(), file) == frame.commands.size() &&
+             fread(raw.data(), sizeof(RenderStreamVertex), raw.size(), file) == raw.size() &&
+             fread(frame.indices.data(), sizeof(int32_t), frame.indices.size(), file) == frame.indices.size();
+        valid = !ok || validFrame(frame, stream.header.textureCount);
+
+        // Into SDL's own layout once, not on every replay
+        frame.vertices.resize(raw.size());
+        for (size_t i = 0; i < raw.size(); i++) {
+            frame.vertices[i].position = {raw[i].x, raw[i].y};
+            frame.vertices[i].color = {raw[i].color[0], raw[i].color[1], raw[i].color[2], raw[i].color[3]};
+            frame.vertices[i].tex_coord = {raw[i].u, raw[i].v};
+        }
+    }
+    fclose(file);
+    if (!ok) {
+        fprintf(stderr, "renderreplay: %s is truncated\n", path);
+    } else if (!valid) {
+        fprintf(stderr, "renderreplay: %s has a command outside its texture table or geometry\n", path);
+    }
+    return ok && valid;
+}
+
+static bool isDraw(uint8_t op) {
+    return op == RENDER_OP_COPY || op == RENDER_OP_FILL_RECT || op == RENDER_OP_LINE || op == RENDER_OP_GEOMETRY;
+}
+
+// What the stream asks of a renderer, independent of which one runs it
+static void printStreamStats(const Stream& stream) {
+    static const char* OP_NAMES[RENDER_OP_COUNT] = {"clear", "copy", "fill_rect", "line", "geometry",
+                                                    "set_target", "read_pixels", "set_scale"};
+    size_t opTotals[RENDER_OP_COUNT] = {};
+    size_t drawTotal = 0, drawMax = 0, switchTotal = 0, switchMax = 0;
+    double recordedMs = 0.0;
+
+    for (const Frame& frame : stream.frames) {
+        size_t draws = 0, switches = 0;
+        int lastTexture = -2;  // a texture change is a likely batch break
+        for (const RenderCommand& command : frame.commands) {
+            if (command.op < RENDER_OP_COUNT) opTotals[command.op]++;
+            if (!isDraw(command.op)) continue;
+            draws++;
+            if (command.texture != lastTexture) {
+                switches++;
+                lastTexture = command.texture;
+            }
+        }
+        drawTotal += draws;
+        drawMax = std::max(drawMax, draws);
+        switchTotal += switches;
+        switchMax = std::max(switchMax, switches);
+        recordedMs += frame.info.renderMs;
+    }
+
+    size_t frames = std::max<size_t>(stream.frames.size(), 1);
+    printf("Stream: %u frames at %dx%d, %u textures; recorded render %.3f ms a frame\n",
+           stream.header.frameCount, stream.header.width, stream.header.height, stream.header.textureCount,
+           recordedMs / frames);
+    printf("  draw calls a frame: mean %.1f max %zu; texture switches a frame: mean %.1f max %zu\n",
+           static_cast<double>(drawTotal) / frames, drawMax, static_cast<double>(switchTotal) / frames, switchMax);
+    printf("  per frame:");
+    for (int op = 0; op < RENDER_OP_COUNT; op++) {
+        if (opTotals[op] > 0) {
+            printf(" %s %.1f", OP_NAMES[op], static_cast<double>(opTotals[op]) / frames);
+        }
+    }
+    printf("\n");
+}
+
+static void applyTextureState(SDL_Texture* texture, const RenderCommand& command) {
+    SDL_SetTextureColorMod(texture, command.color[0], command.color[1], command.color[2]);
+    SDL_SetTextureAlphaMod(texture, command.color[3]);
+    SDL_SetTextureBlendMode(texture, static_cast<SDL_BlendMode>(command.blend));
+}
+
+static void applyDrawState(SDL_Renderer* renderer, const RenderCommand& command) {
+    SDL_SetRenderDrawColor(renderer, command.color[0], command.color[1], command.color[2], command.color[3]);
+    SDL_SetRenderDrawBlendMode(renderer, static_cast<SDL_BlendMode>(command.blend));
+}
+
+static void replayFrame(SDL_Renderer* renderer, const Frame& frame, const std::vector<SDL_Texture*>& textures,
+                        const Stream& stream, std::vector<Uint8>& readback) {
+    size_t vertex = 0, index = 0;
+    int targetW = stream.header.width, targetH = stream.header.height;
+
+    for (const RenderCommand& command : frame.commands) {
+        SDL_Texture* texture = command.texture >= 0 ? textures[command.texture] : nullptr;
+        SDL_Rect src = {static_cast<int>(command.src[0]), static_cast<int>(command.src[1]),
+                        static_cast<int>(command.src[2]), static_cast<int>(command.src[3])};
+        SDL_FRect dst = {command.dst[0], command.dst[1], command.dst[2], command.dst[3]};
+        SDL_FPoint center = {command.center[0], command.center[1]};
+
+        switch (command.op) {
+            case RENDER_OP_CLEAR:
+                SDL_SetRenderDrawColor(renderer, command.color[0], command.color[1], command.color[2], command.color[3]);
+                SDL_RenderClear(renderer);
+                break;
+            case RENDER_OP_COPY:
+                if (!texture) break;
+                applyTextureState(texture, command);
+                SDL_RenderCopyExF(renderer, texture, src.w >= 0 ? &src : nullptr, dst.w >= 0 ? &dst : nullptr,
+                                  command.angle, command.hasCenter ? &center : nullptr,
+                                  static_cast<SDL_RendererFlip>(command.flip));
+                break;
+            case RENDER_OP_FILL_RECT:
+                applyDrawState(renderer, command);
+                SDL_RenderFillRectF(renderer, dst.w >= 0 ? &dst : nullptr);
+                break;
+            case RENDER_OP_LINE:
+                applyDrawState(renderer, command);
+                SDL_RenderDrawLineF(renderer, command.dst[0], command.dst[1], command.dst[2], command.dst[3]);
+                break;
+            case RENDER_OP_GEOMETRY:
+                if (texture) {
+                    applyTextureState(texture, command);
+                } else {
+                    applyDrawState(renderer, command);
+                }
+                SDL_RenderGeometry(renderer, texture, frame.vertices.data() + vertex, command.vertexCount,
+                                   command.indexCount ? frame.indices.data() + index : nullptr, command.indexCount);
+                vertex += command.vertexCount;
+                index += command.indexCount;
+                break;
+            case RENDER_OP_SET_TARGET:
+                SDL_SetRenderTarget(renderer, texture);
+                if (texture) {
+                    targetW = stream.textures[command.texture].width;
+                    targetH = stream.textures[command.texture].height;
+                } else {
+                    targetW = stream.header.width;
+                    targetH = stream.header.height;
+                }
+                break;
+            case RENDER_OP_READ_PIXELS: {
+                SDL_Rect rect = {static_cast<int>(dst.x), static_cast<int>(dst.y), static_cast<int>(dst.w),
+                                 static_cast<int>(dst.h)};
+                int w = dst.w >= 0 ? rect.w : targetW;
+                int h = dst.w >= 0 ? rect.h : targetH;
+                readback.resize(std::max(readback.size(), static_cast<size_t>(w) * h * 4));
+                SDL_RenderReadPixels(renderer, dst.w >= 0 ? &rect : nullptr, SDL_PIXELFORMAT_RGBA32,
+                                     readback.data(), w * 4);
+                break;
+            }
+            case RENDER_OP_SET_SCALE:
+                SDL_RenderSetScale(renderer, command.dst[0], command.dst[1]);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+// Same-sized textures with a checker pattern; targets are left for the stream to draw into
+static std::vector<SDL_Texture*> createStandIns(SDL_Renderer* renderer, const Stream& stream) {
+    std::vector<SDL_Texture*> textures;
+    std::vector<Uint32> pixels;
+    for (const RenderStreamTexture& shape : stream.textures) {
+        int w = std::max(shape.width, 1);
+        int h = std::max(shape.height, 1);
+        bool target = shape.access == SDL_TEXTUREACCESS_TARGET;
+        SDL_Texture* texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32,
+                                                 target ? SDL_TEXTUREACCESS_TARGET : SDL_TEXTUREACCESS_STATIC, w, h);
+        if (texture && !target) {
+            pixels.resize(static_cast<size_t>(w) * h);
+            for (int y = 0; y < h; y++) {
+                for (int x = 0; x < w; x++) {
+                    pixels[y * w + x] = ((x / 4 + y / 4) & 1) ? 0xFFC0C0C0 : 0xFF606060;
+                }
+            }
+            SDL_UpdateTexture(texture, nullptr, pixels.data(), w * 4);
+        }
+        textures.push_back(texture);
+    }
+    return textures;
+}
+
+static Timing replay(const Stream& stream, const char* name, Uint32 flags, int loops) {
+    Timing timing;
+    timing.renderer = name;
+
+    SDL_Window* window = SDL_CreateWindow("renderreplay", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED,
+                                          stream.header.width, stream.header.height, SDL_WINDOW_HIDDEN);
+    SDL_Renderer* renderer = window ? SDL_CreateRenderer(window, -1, flags) : nullptr;  // no vsync
+    if (!renderer) {
+        printf("%s: not available (%s)\n", name, SDL_GetError());
+        if (window) SDL_DestroyWindow(window);
+        return timing;
+    }
+    SDL_RendererInfo info;
+    SDL_GetRendererInfo(renderer, &info);
+
+    std::vector<SDL_Texture*> textures = createStandIns(renderer, stream);
+    std::vector<Uint8> readback;
+    std::vector<double> frameMs;
+    frameMs.reserve(stream.frames.size() * loops);
+
+    // The first pass warms up the driver and isn't counted
+    for (int loop = 0; loop <= loops; loop++) {
+        for (const Frame& frame : stream.frames) {
+            Uint64 start = SDL_GetPerformanceCounter();
+            replayFrame(renderer, frame, textures, stream, readback);
+            SDL_RenderPresent(renderer);
+            Uint64 end = SDL_GetPerformanceCounter();
+            if (loop > 0) {
+                frameMs.push_back((end - start) * 1000.0 / SDL_GetPerformanceFrequency());
+            }
+        }
+    }
+
+    if (!frameMs.empty()) {
+        timing.ran = true;
+        double total = 0.0;
+        for (double ms : frameMs) total += ms;
+        timing.mean = total / frameMs.size();
+        std::sort(frameMs.begin(), frameMs.end());
+        timing.p50 = frameMs[frameMs.size() / 2];
+        timing.p95 = frameMs[std::min(frameMs.size() - 1, frameMs.size() * 95 / 100)];
+        timing.max = frameMs.back();
+        printf("%s (%s): %zu frames, ms a frame mean %.3f p50 %.3f p95 %.3f max %.3f\n", name, info.name,
+               frameMs.size(), timing.mean, timing.p50, timing.p95, timing.max);
+    }
+
+    for (SDL_Texture* texture : textures) {
+        if (texture) SDL_DestroyTexture(texture);
+    }
+    SDL_DestroyRenderer(renderer);
+    SDL_DestroyWindow(window);
+    return timing;
+}
+
+static bool writeJson(const std::string& path, const std::vector<Timing>& timings) {
+    FILE* file = fopen(path.c_str(), "w");
+    if (!file) return false;
+    fprintf(file, "{\"renderers\": [");
+    for (size_t i = 0; i < timings.size(); i++) {
+        const Timing& timing = timings[i];
+        fprintf(file, "%s\n  {\"renderer\": \"%s\", \"ran\": %s, \"mean_ms\": %.4f, \"p50_ms\": %.4f, "
+                      "\"p95_ms\": %.4f, \"max_ms\": %.4f}",
+                i == 0 ? "" : ",", timing.renderer.c_str(), timing.ran ? "true" : "false", timing.mean,
+                timing.p50, timing.p95, timing.max);
+    }
+    fprintf(file, "\n]}\n");
+    return fclose(file) == 0;
+}
+
+int main(int argc, char* argv[]) {
+    bool software = false;
+    bool accelerated = false;
+    bool headless = false;
+    int loops = 3;
+    const char* path = nullptr;
+    std::string jsonPath;
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = i + 1 < argc;
+        if (std::strcmp(argv[i], "--software") == 0) {
+            software = true;
+        } else if (std::strcmp(argv[i], "--accelerated") == 0) {
+            accelerated = true;
+        } else if (std::strcmp(argv[i], "--headless") == 0) {
+            headless = true;
+        } else if (std::strcmp(argv[i], "--loops") == 0 && hasValue) {
+            loops = std::max(1, atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--json") == 0 && hasValue) {
+            jsonPath = argv[++i];
+        } else if (argv[i][0] != '-' && !path) {
+            path = argv[i];
+        } else {
+            path = nullptr;
+            break;
+        }
+    }
+    if (!path) {
+        fprintf(stderr, "usage: renderreplay [--software] [--accelerated] [--loops N] [--headless] "
+                        "[--json out.json] render.frs\n");
+        return 2;
+    }
+    if (!software && !accelerated) {
+        software = accelerated = true;
+    }
+
+    Stream stream;
+    if (!load(path, stream)) return 1;
+    printStreamStats(stream);
+
+    if (headless) {
+        SDL_setenv("SDL_VIDEODRIVER", "dummy", 1);
+    }
+    if (SDL_Init(SDL_INIT_VIDEO) < 0) {
+        fprintf(stderr, "renderreplay: SDL_Init failed: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    std::vector<Timing> timings;
+    if (software) timings.push_back(replay(stream, "software", SDL_RENDERER_SOFTWARE, loops));
+    if (accelerated) timings.push_back(replay(stream, "accelerated", SDL_RENDERER_ACCELERATED, loops));
+    SDL_Quit();
+
+    if (!jsonPath.empty() && !writeJson(jsonPath, timings)) {
+        fprintf(stderr, "renderreplay: can't write %s\n", jsonPath.c_str());
+        return 1;
+    }
+    return 0;
+}
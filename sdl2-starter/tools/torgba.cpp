@@ -0,0 +1,79 @@
+// Converts images to the pre-decoded .rgba format (src/RawImageFormat.h) that
+// the game loads in place of the PNGs when it finds them.
+//
+//   torgba <in.png> <out.rgba> [<in.png> <out.rgba> ...]
+//
+// Missing directories in each output path are created.
+
+#include "../src/RawImageFormat.h"
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_image.h>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <sys/stat.h>
+
+// mkdir -p for everything before the last '/'
+static bool makeParentDirs(const std::string& path) {
+    for (size_t slash = path.find('/', 1); slash != std::string::npos; slash = path.find('/', slash + 1)) {
+        std::string dir = path.substr(0, slash);
+        if (mkdir(dir.c_str(), 0755) != 0 && errno != EEXIST) return false;
+    }
+    return true;
+}
+
+static bool convert(const char* inPath, const char* outPath) {
+    SDL_Surface* loaded = IMG_Load(inPath);
+    if (!loaded) {
+        fprintf(stderr, "torgba: can't load %s: %s\n", inPath, IMG_GetError());
+        return false;
+    }
+    SDL_Surface* rgba = SDL_ConvertSurfaceFormat(loaded, SDL_PIXELFORMAT_RGBA32, 0);
+    SDL_FreeSurface(loaded);
+    if (!rgba) {
+        fprintf(stderr, "torgba: can't convert %s: %s\n", inPath, SDL_GetError());
+        return false;
+    }
+
+    RawImageHeader header;
+    std::memcpy(header.magic, RAW_IMAGE_MAGIC, sizeof(RAW_IMAGE_MAGIC));
+    header.version = RAW_IMAGE_VERSION;
+    header.width = static_cast<uint32_t>(rgba->w);
+    header.height = static_cast<uint32_t>(rgba->h);
+
+    FILE* out = makeParentDirs(outPath) ? fopen(outPath, "wb") : nullptr;
+    if (!out) {
+        fprintf(stderr, "torgba: can't write %s\n", outPath);
+        SDL_FreeSurface(rgba);
+        return false;
+    }
+    fwrite(&header, sizeof(header), 1, out);
+
+    // Rows go out unpadded whatever the surface's pitch
+    const uint8_t* row = static_cast<const uint8_t*>(rgba->pixels);
+    for (int y = 0; y < rgba->h; y++, row += rgba->pitch) {
+        fwrite(row, 4, rgba->w, out);
+    }
+    bool ok = ferror(out) == 0;
+    ok = fclose(out) == 0 && ok;
+    SDL_FreeSurface(rgba);
+
+    if (!ok) fprintf(stderr, "torgba: error writing %s\n", outPath);
+    return ok;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 3 || (argc - 1) % 2 != 0) {
+        fprintf(stderr, "usage: %s <in.png> <out.rgba> [<in.png> <out.rgba> ...]\n", argv[0]);
+        return 1;
+    }
+
+    int converted = 0;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (!convert(argv[i], argv[i + 1])) return 1;
+        converted++;
+    }
+    printf("Converted %d images to .rgba\n", converted);
+    return 0;
+}